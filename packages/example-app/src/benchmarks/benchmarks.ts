@@ -1,6 +1,9 @@
 import type { Bench } from "tinybench";
 import type { BenchFn, BenchmarkResult, SuiteState } from "@/types/benchmarks";
 
+// Name of the task measuring this SDK in every bench - all other tasks are challengers
+export const SDK_TASK_NAME = "provable-mobile-sdk";
+
 export class BenchmarkSuite {
   name: string;
   enabled: boolean;
@@ -35,8 +38,8 @@ export class BenchmarkSuite {
 
   processResults = (b: Bench): void => {
     const tasks = b.tasks;
-    const us = tasks.find((t) => t.name === "rnqc");
-    const themTasks = tasks.filter((t) => t.name !== "rnqc");
+    const us = tasks.find((t) => t.name === SDK_TASK_NAME);
+    const themTasks = tasks.filter((t) => t.name !== SDK_TASK_NAME);
 
     themTasks.map((them) => {
       const notes = this.notes?.[them.name] ?? "";
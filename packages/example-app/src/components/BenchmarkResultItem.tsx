@@ -1,5 +1,6 @@
 import type React from "react";
 import { StyleSheet, Text, View } from "react-native";
+import { SDK_TASK_NAME } from "@/benchmarks/benchmarks";
 import { calculateTimes, formatNumber } from "@/benchmarks/utils";
 import { useThemeColors } from "@/hooks/useThemeColors";
 import type { BenchmarkResult } from "@/types/benchmarks";
@@ -17,7 +18,7 @@ export const BenchmarkResultItemHeader: React.FC = () => {
     <View style={styles.itemContainer}>
       <Text style={[styles.text, styles.description, { color: colors.text }]}>&nbsp;</Text>
       <Text style={[styles.label, { color: colors.text }]}>times</Text>
-      <Text style={[styles.label, { color: colors.text }]}>rnqc</Text>
+      <Text style={[styles.label, { color: colors.text }]}>{SDK_TASK_NAME}</Text>
       <Text style={[styles.label, { color: colors.text }]}>challenger</Text>
     </View>
   );
@@ -1,6 +1,17 @@
 import { expect } from 'chai';
 import { test, assertThrowsAsync } from '../util';
-import { createAccount, type Account } from 'provable-mobile-sdk';
+import {
+  createAccount,
+  isBitSet,
+  packBatch,
+  packStrings,
+  scanRecordChunks,
+  unpackAccounts,
+  unpackBatch,
+  unpackOwnedRecords,
+  type Account,
+  type OwnedRecord,
+} from 'provable-mobile-sdk';
 
 const SUITE = 'account';
 
@@ -310,3 +321,455 @@ test(SUITE, 'Memory management: multiple operations don\'t leak', async () => {
     await viewKey.toString();
   }
 });
+
+test(SUITE, 'Synchronous toString and Account conversion methods', () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+
+  // toString is a synchronous getter on the native objects
+  expect(privateKey.toString()).to.equal(KNOWN_PRIVATE_KEY);
+
+  const address = account.addressFromPrivateKey(privateKey);
+  expect(address.toString()).to.equal(KNOWN_ADDRESS);
+
+  const viewKey = account.viewKeyFromPrivateKey(privateKey);
+  expect(viewKey.toString()).to.equal(KNOWN_VIEW_KEY);
+
+  const addressFromViewKey = account.addressFromViewKey(viewKey);
+  expect(addressFromViewKey.toString()).to.equal(KNOWN_ADDRESS);
+});
+
+test(SUITE, 'Batch signing returns one verifiable signature per message', async () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+  const address = account.addressFromString(KNOWN_ADDRESS);
+
+  const messages = Array.from({ length: 16 }, (_, i) => {
+    const messageBuffer = new ArrayBuffer(i * 8);
+    new Uint8Array(messageBuffer).fill(i);
+    return messageBuffer;
+  });
+
+  const signatures = unpackBatch(await privateKey.signBatch(messages));
+  expect(signatures.length).to.equal(messages.length);
+
+  for (let i = 0; i < messages.length; i++) {
+    const isValid = await address.verify(signatures[i]!, messages[i]!);
+    expect(isValid).to.be.true;
+  }
+});
+
+test(SUITE, 'Batch verification flags exactly the invalid triples', async () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+  const otherAddress = (await account.createPrivateKey().toAddress()).toString();
+  const encoder = new TextEncoder();
+  const toBuffer = (bytes: Uint8Array): ArrayBuffer => bytes.slice().buffer;
+
+  const messages = Array.from({ length: 10 }, (_, i) => toBuffer(encoder.encode(`message ${i}`)));
+  const signatures = unpackBatch(await privateKey.signBatch(messages));
+
+  // Triple 3 uses the wrong signer, triple 7 a tampered message
+  const triples = messages.flatMap((message, i) => [
+    toBuffer(encoder.encode(i === 3 ? otherAddress : KNOWN_ADDRESS)),
+    signatures[i]!,
+    i === 7 ? toBuffer(encoder.encode('tampered')) : message,
+  ]);
+
+  const bitmap = await account.verifyBatch(packBatch(triples));
+  for (let i = 0; i < messages.length; i++) {
+    expect(isBitSet(bitmap, i)).to.equal(i !== 3 && i !== 7);
+  }
+});
+
+test(SUITE, 'Signing and derivation do not block the JS thread', async () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+  const messageBuffer = new ArrayBuffer(1024);
+  const iterations = 20;
+
+  let blocked = 0;
+  let total = 0;
+  for (let i = 0; i < iterations; i++) {
+    const start = performance.now();
+    const pending = Promise.all([privateKey.sign(messageBuffer), privateKey.toAddress(), privateKey.toViewKey()]);
+    blocked += performance.now() - start;
+    await pending;
+    total += performance.now() - start;
+  }
+
+  // Only argument marshalling and dispatch may run before the promises are returned
+  expect(blocked).to.be.lessThan(
+    total / 4,
+    `JS thread blocked ${(blocked / iterations).toFixed(3)}ms of ${(total / iterations).toFixed(3)}ms per sign + derive`,
+  );
+});
+
+test(SUITE, 'Cancelled operations reject before running', async () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+  const address = account.addressFromString(KNOWN_ADDRESS);
+  const messageBuffer = new ArrayBuffer(32);
+  const signature = await privateKey.sign(messageBuffer);
+
+  const token = account.createCancellationToken();
+  expect(token.isCancelled).to.be.false;
+  token.cancel();
+  expect(token.isCancelled).to.be.true;
+
+  const outcomes = await Promise.allSettled([
+    privateKey.sign(messageBuffer, token),
+    privateKey.signBatch([messageBuffer], token),
+    address.verify(signature, messageBuffer, token),
+  ]);
+  for (const outcome of outcomes) {
+    expect(outcome.status).to.equal('rejected');
+  }
+
+  // Operations without the token are unaffected
+  expect(await address.verify(signature, messageBuffer)).to.be.true;
+});
+
+test(SUITE, 'Derivation cache memoizes addresses and view keys', async () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+  account.setDerivationCacheSize(4);
+
+  try {
+    const before = account.getDerivationCacheStats();
+    const first = await privateKey.toAddress();
+    const second = await account.privateKeyFromString(KNOWN_PRIVATE_KEY).toAddress();
+    const viewKey = await privateKey.toViewKey();
+    const cachedViewKey = await privateKey.toViewKey();
+    const after = account.getDerivationCacheStats();
+
+    expect(first.toString()).to.equal(KNOWN_ADDRESS);
+    expect(second.toString()).to.equal(KNOWN_ADDRESS);
+    expect(cachedViewKey.toString()).to.equal(viewKey.toString());
+    expect(after.hits - before.hits).to.equal(2);
+    expect(after.misses - before.misses).to.equal(2);
+    expect(after.capacity).to.equal(4);
+  } finally {
+    account.setDerivationCacheSize(0);
+  }
+  expect(account.getDerivationCacheStats().size).to.equal(0);
+});
+
+test(SUITE, 'Address cache warm-up counts only valid addresses', async () => {
+  const account = getAccount();
+  const contacts = [KNOWN_ADDRESS, (await account.createPrivateKey().toAddress()).toString(), 'aleo1invalid'];
+
+  expect(await account.warmAddressCache(contacts)).to.equal(2);
+  expect(account.addressFromString(KNOWN_ADDRESS).toString()).to.equal(KNOWN_ADDRESS);
+  expect(() => account.addressFromString('aleo1invalid')).to.throw();
+});
+
+test(SUITE, 'Signatures from the precomputed signing context verify', async () => {
+  const account = getAccount();
+  await account.prepareSigningContext();
+
+  const privateKey = account.createPrivateKey();
+  const address = await privateKey.toAddress();
+  const viewKey = await privateKey.toViewKey();
+  expect((await viewKey.toAddress()).toString()).to.equal(address.toString());
+
+  const message = new TextEncoder().encode('fixed-base tables').slice().buffer;
+  const signature = await privateKey.sign(message);
+  expect(await address.verify(signature, message)).to.be.true;
+  expect(await account.addressFromString(KNOWN_ADDRESS).verify(signature, message)).to.be.false;
+});
+
+test(SUITE, 'Account derivation is deterministic per index', async () => {
+  const account = getAccount();
+  const seed = new Uint8Array(32).fill(42).buffer;
+
+  const accounts = unpackAccounts(await account.deriveAccounts(seed, 0, 8));
+  const tail = unpackAccounts(await account.deriveAccounts(seed, 4, 4));
+  expect(accounts.length).to.equal(8);
+  expect(tail).to.deep.equal(accounts.slice(4));
+  expect(new Set(accounts.map(({ address }) => address)).size).to.equal(8);
+
+  for (const derived of accounts.slice(0, 2)) {
+    const privateKey = account.privateKeyFromString(derived.privateKey);
+    expect((await privateKey.toAddress()).toString()).to.equal(derived.address);
+    expect((await privateKey.toViewKey()).toString()).to.equal(derived.viewKey);
+  }
+
+  await assertThrowsAsync(() => account.deriveAccounts(new ArrayBuffer(16), 0, 1), 'The seed must be 32 bytes');
+  await assertThrowsAsync(() => account.deriveAccounts(seed, 0, 4097), 'At most 4096 accounts can be derived per call');
+});
+
+test(SUITE, 'Vanity search finds a matching address and can be cancelled', async () => {
+  const account = getAccount();
+
+  const search = account.startVanitySearch('q', '');
+  const privateKey = await search.result();
+  const address = (await privateKey.toAddress()).toString();
+  expect(address.startsWith('aleo1q')).to.be.true;
+  expect(search.attempts).to.be.greaterThan(0);
+
+  const endless = account.startVanitySearch('qqqqqqqqqqqq', '');
+  await new Promise((resolve) => setTimeout(resolve, 200));
+  expect(endless.attemptsPerSecond).to.be.greaterThan(0);
+  endless.cancel();
+  await assertThrowsAsync(() => endless.result(), 'Vanity search was cancelled');
+
+  expect(() => account.startVanitySearch('b', '')).to.throw('Invalid vanity pattern');
+});
+
+test(SUITE, 'Streaming signatures verify chunk by chunk', async () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+  const address = account.addressFromString(KNOWN_ADDRESS);
+  const chunks = Array.from({ length: 8 }, (_, i) => new Uint8Array(10_000 + i).fill(i).buffer);
+
+  const signer = privateKey.createSigner();
+  for (const chunk of chunks) {
+    await signer.update(chunk);
+  }
+  const signature = await signer.finalize();
+
+  // Chunk boundaries don't matter, only the bytes
+  const verifier = address.createVerifier();
+  const joined = new Uint8Array(chunks.reduce((total, chunk) => total + chunk.byteLength, 0));
+  let offset = 0;
+  for (const chunk of chunks) {
+    joined.set(new Uint8Array(chunk), offset);
+    offset += chunk.byteLength;
+  }
+  await verifier.update(joined.slice(0, 12_345).buffer);
+  await verifier.update(joined.slice(12_345).buffer);
+  expect(await verifier.finalize(signature)).to.be.true;
+
+  const tampered = address.createVerifier();
+  await tampered.update(chunks[0]!);
+  expect(await tampered.finalize(signature)).to.be.false;
+
+  await assertThrowsAsync(() => signer.finalize(), 'already been finalized');
+
+  // Stream signatures cover the largest field element followed by the digest, a layout field signing refuses
+  const reserved = new Uint8Array(64);
+  reserved.set([0, 0, 0, 0, 0, 128, 17, 10, 1, 0, 0, 208, 254, 118, 170, 89, 1, 176, 55, 92, 30, 77, 180, 96, 86, 165, 44, 154, 94, 101, 171, 18]);
+  await assertThrowsAsync(() => privateKey.signFields(reserved.buffer), 'Invalid encoded message');
+  expect(() => account.encodedMessageFromFields(reserved.buffer)).to.throw('Invalid field elements');
+});
+
+test(SUITE, 'Stats record operations only while enabled', async () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+  const message = new Uint8Array(64).fill(3).buffer;
+
+  account.resetStats();
+  await privateKey.sign(message);
+  expect(account.getStats().sign.count).to.equal(0);
+
+  account.setStatsEnabled(true);
+  try {
+    await privateKey.sign(message);
+    await privateKey.sign(message);
+    const stats = account.getStats();
+    expect(stats.enabled).to.be.true;
+    expect(stats.sign.count).to.equal(2);
+    expect(stats.sign.p50Micros).to.be.greaterThan(0);
+    expect(stats.sign.maxMicros).to.be.at.least(stats.sign.p99Micros);
+    expect(stats.privateKeys.liveHandles).to.be.greaterThan(0);
+
+    account.resetStats();
+    expect(account.getStats().sign.count).to.equal(0);
+  } finally {
+    account.setStatsEnabled(false);
+  }
+});
+
+test(SUITE, 'Binary key and address forms round-trip', async () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+  const address = account.addressFromString(KNOWN_ADDRESS);
+  const viewKey = await privateKey.toViewKey();
+
+  const privateKeyBytes = privateKey.toBytes();
+  const addressBytes = address.toBytes();
+  expect(privateKeyBytes.byteLength).to.equal(32);
+  expect(addressBytes.byteLength).to.equal(32);
+  expect(viewKey.toBytes().byteLength).to.equal(32);
+
+  expect(account.privateKeyFromBytes(privateKeyBytes).toString()).to.equal(KNOWN_PRIVATE_KEY);
+  expect(account.addressFromBytes(addressBytes).toString()).to.equal(KNOWN_ADDRESS);
+  expect(account.viewKeyFromBytes(viewKey.toBytes()).toString()).to.equal(viewKey.toString());
+
+  // A key restored from bytes signs for the same address
+  const message = new Uint8Array([1, 2, 3]).buffer;
+  const signature = await account.privateKeyFromBytes(privateKeyBytes).sign(message);
+  expect(await address.verify(signature, message)).to.be.true;
+
+  expect(() => account.addressFromBytes(new Uint8Array(31).buffer)).to.throw('Invalid address bytes');
+  expect(() => account.privateKeyFromBytes(new Uint8Array(33).buffer)).to.throw('Invalid private key bytes');
+});
+
+test(SUITE, 'Signing reports oversized messages and keeps working', async () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+  const address = account.addressFromString(KNOWN_ADDRESS);
+
+  await assertThrowsAsync(
+    () => privateKey.sign(new Uint8Array(256 * 1024).buffer),
+    'exceeds maximum allowed size',
+  );
+
+  // Back-to-back signatures reuse the same per-thread buffers
+  for (let i = 0; i < 4; i++) {
+    const message = new Uint8Array([i, 1, 2, 3]).buffer;
+    expect(await address.verify(await privateKey.sign(message), message)).to.be.true;
+  }
+});
+
+test(SUITE, 'Bulk validation flags invalid entries and parses the rest', async () => {
+  const account = getAccount();
+  const otherAddress = (await account.createPrivateKey().toAddress()).toString();
+  // A bad checksum, a wrong prefix and a wrong length are all caught by the pre-filter
+  const tampered = KNOWN_ADDRESS.slice(0, -1) + (KNOWN_ADDRESS.endsWith('q') ? 'p' : 'q');
+  const entries = [KNOWN_ADDRESS, tampered, 'aleo2' + KNOWN_ADDRESS.slice(5), '', otherAddress, KNOWN_ADDRESS.slice(0, 40)];
+
+  const checked = await account.validateAddresses(packStrings(entries));
+  expect(entries.map((_, i) => isBitSet(checked.valid, i))).to.deep.equal([true, false, false, false, true, false]);
+  expect(checked.addresses).to.have.length(0);
+
+  const parsed = await account.validateAddresses(packStrings(entries), true);
+  expect(parsed.addresses.map((address) => address.toString())).to.deep.equal([KNOWN_ADDRESS, otherAddress]);
+
+  const keys = await account.validatePrivateKeys(packStrings([KNOWN_PRIVATE_KEY, KNOWN_VIEW_KEY, KNOWN_PRIVATE_KEY + '0']), true);
+  expect([0, 1, 2].map((i) => isBitSet(keys.valid, i))).to.deep.equal([true, false, false]);
+  expect(keys.privateKeys[0]!.toString()).to.equal(KNOWN_PRIVATE_KEY);
+
+  const viewKeys = await account.validateViewKeys(packStrings([KNOWN_PRIVATE_KEY, KNOWN_VIEW_KEY]));
+  expect([0, 1].map((i) => isBitSet(viewKeys.valid, i))).to.deep.equal([false, true]);
+});
+
+test(SUITE, 'Warm-up runs once and reports its timings', async () => {
+  const account = getAccount();
+  const first = await account.warmUp();
+  const parts = first.registriesMillis + first.networkMillis + first.signingContextMillis + first.threadPoolMillis;
+  expect(first.totalMillis).to.be.at.least(parts - 0.001);
+
+  // Later calls resolve with the timings of the single run instead of repeating it
+  expect(await account.warmUp()).to.deep.equal(first);
+});
+
+test(SUITE, 'Record scanning skips records the view key does not own', async () => {
+  const account = getAccount();
+  const viewKey = account.viewKeyFromString(KNOWN_VIEW_KEY);
+
+  // Malformed entries are skipped rather than failing the whole chunk
+  const owned = await viewKey.scanRecords(packStrings(['record1invalid', '', KNOWN_ADDRESS]));
+  expect(unpackOwnedRecords(owned)).to.deep.equal([]);
+
+  const streamed: OwnedRecord[] = [];
+  for await (const record of scanRecordChunks(viewKey, [['record1invalid'], [], ['not a record']])) {
+    streamed.push(record);
+  }
+  expect(streamed).to.deep.equal([]);
+
+  await assertThrowsAsync(() => viewKey.scanRecords(new Uint8Array([1, 2]).buffer), 'Malformed record batch');
+});
+
+test(SUITE, 'Restoring accounts falls back to derivation without a usable cache', async () => {
+  const account = getAccount();
+  const secret = new Uint8Array(32).fill(7).buffer;
+
+  // The cache can't be written here, so every call derives and still succeeds
+  const path = '/nonexistent-directory/accounts.cache';
+  for (let i = 0; i < 2; i++) {
+    const restored = await account.restoreAccounts(path, secret, [KNOWN_PRIVATE_KEY]);
+    expect(restored.cached).to.equal(0);
+    expect(restored.derived).to.equal(1);
+    expect(restored.accounts[0].privateKey.toString()).to.equal(KNOWN_PRIVATE_KEY);
+    expect(restored.accounts[0].viewKey.toString()).to.equal(KNOWN_VIEW_KEY);
+    expect(restored.accounts[0].address.toString()).to.equal(KNOWN_ADDRESS);
+  }
+
+  await assertThrowsAsync(() => account.restoreAccounts(path, new ArrayBuffer(16), [KNOWN_PRIVATE_KEY]), 'The cache secret must be 32 bytes');
+  await assertThrowsAsync(() => account.restoreAccounts(path, secret, [KNOWN_PRIVATE_KEY, 'APrivateKey1']), 'Invalid private key at index 1');
+});
+
+test(SUITE, 'Key strings keep their exact encoding through the secret arena', async () => {
+  const account = getAccount();
+
+  // Many keys formatted at once outnumber the arena's slots, the overflow goes through heap buffers
+  const keys = Array.from({ length: 100 }, () => account.createPrivateKey());
+  const strings = await Promise.all(keys.map(async (key) => key.toString()));
+  for (const string of strings) {
+    expect(account.privateKeyFromString(string).toString()).to.equal(string);
+  }
+  const viewKey = account.viewKeyFromString(KNOWN_VIEW_KEY);
+  expect(viewKey.toString()).to.equal(KNOWN_VIEW_KEY);
+
+  // Truncated, extended, non-base58 and wrong-kind strings are still rejected
+  for (const invalid of [KNOWN_PRIVATE_KEY.slice(0, -1), KNOWN_PRIVATE_KEY + '1', KNOWN_PRIVATE_KEY.replace('z', '0'), KNOWN_VIEW_KEY]) {
+    expect(() => account.privateKeyFromString(invalid)).to.throw('Invalid private key format');
+  }
+  expect(() => account.viewKeyFromString(KNOWN_PRIVATE_KEY)).to.throw('Invalid view key format');
+});
+
+test(SUITE, 'Nonce pool precomputes nonces that each sign once', async () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+  const address = account.addressFromString(KNOWN_ADDRESS);
+  const message = new TextEncoder().encode('pooled').buffer;
+  account.setNoncePoolSize(8, 8);
+
+  try {
+    for (let i = 0; i < 100 && account.getNoncePoolStats().available < 8; i++) {
+      await new Promise((resolve) => setTimeout(resolve, 20));
+    }
+    const before = account.getNoncePoolStats();
+    expect(before.depth).to.equal(8);
+    expect(before.available).to.equal(8);
+
+    const signatures = [];
+    for (let i = 0; i < 3; i++) {
+      signatures.push(await privateKey.sign(message));
+    }
+    expect(account.getNoncePoolStats().pooledSignatures - before.pooledSignatures).to.equal(3);
+    for (const signature of signatures) {
+      expect(await address.verify(signature, message)).to.be.true;
+    }
+    const encoded = signatures.map((signature) => Array.from(new Uint8Array(signature)).join());
+    expect(new Set(encoded).size).to.equal(3);
+  } finally {
+    account.setNoncePoolSize(0);
+  }
+  const after = account.getNoncePoolStats();
+  expect(after.available).to.equal(0);
+  expect(after.depth).to.equal(0);
+});
+
+test(SUITE, 'Encoded messages sign and verify like the bytes they were encoded from', async () => {
+  const account = getAccount();
+  const privateKey = account.privateKeyFromString(KNOWN_PRIVATE_KEY);
+  const address = account.addressFromString(KNOWN_ADDRESS);
+  const message = TEST_MESSAGE_BYTES.buffer as ArrayBuffer;
+
+  // 27 bytes fit in a single field element
+  const encoded = account.encodeMessage(message);
+  expect(encoded.fieldCount).to.equal(1);
+  const fields = encoded.toFields();
+  expect(fields.byteLength).to.equal(32);
+  expect(account.encodedMessageFromFields(fields).fieldCount).to.equal(1);
+
+  const signature = await privateKey.signEncoded(encoded);
+  expect(await address.verify(signature, message)).to.be.true;
+  expect(await address.verifyEncoded(signature, encoded)).to.be.true;
+  expect(await address.verifyFields(signature, fields)).to.be.true;
+
+  const fieldSignature = await privateKey.signFields(fields);
+  expect(await address.verifyFields(fieldSignature, fields)).to.be.true;
+  expect(await address.verify(fieldSignature, message)).to.be.true;
+  expect(await address.verifyEncoded(fieldSignature, account.encodeMessage(new ArrayBuffer(4)))).to.be.false;
+
+  // Packed fields must be whole 32-byte values below the field modulus
+  const overModulus = new Uint8Array(32).fill(0xff).buffer;
+  expect(() => account.encodedMessageFromFields(new ArrayBuffer(31))).to.throw('Invalid field elements');
+  expect(() => account.encodedMessageFromFields(overModulus)).to.throw('Invalid field elements');
+  await assertThrowsAsync(() => privateKey.signFields(overModulus), 'Invalid encoded message');
+  expect(await address.verifyFields(signature, new ArrayBuffer(31))).to.be.false;
+});
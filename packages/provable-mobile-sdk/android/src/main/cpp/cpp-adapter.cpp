@@ -1,8 +1,13 @@
 #include <fbjni/fbjni.h>
 #include <jni.h>
 
+#include "HybridAccount.hpp"
 #include "ProvableMobileSdkOnLoad.hpp"
 
 JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void*) {
-  return facebook::jni::initialize(vm, [=] { margelo::nitro::cojson_core_rn::initialize(vm); });
+#ifndef PROVABLE_MOBILE_SDK_NO_WARM_UP
+  // Initialize the Rust crypto state in the background while the app finishes starting up
+  margelo::nitro::provable::HybridAccount::startWarmUp();
+#endif
+  return margelo::nitro::provable::initialize(vm);
 }
@@ -0,0 +1,78 @@
+//! Parse and serialize cost of the bech32 string forms against the fixed-size
+//! little-endian byte forms. Run with `cargo bench --bench encoding`.
+
+use std::str::FromStr;
+use std::time::{Duration, Instant};
+
+use snarkvm_console::{
+    account::{Address, PrivateKey, ViewKey},
+    network::MainnetV0,
+    prelude::{FromBytes, ToBytes},
+};
+
+type CurrentNetwork = MainnetV0;
+
+const ITERATIONS: usize = 2_000;
+
+fn percentile(samples: &mut [Duration], p: f64) -> Duration {
+    samples.sort_unstable();
+    samples[((samples.len() - 1) as f64 * p).round() as usize]
+}
+
+fn measure(name: &str, mut f: impl FnMut()) {
+    for _ in 0..ITERATIONS / 10 {
+        f();
+    }
+    let mut samples: Vec<Duration> = (0..ITERATIONS)
+        .map(|_| {
+            let start = Instant::now();
+            f();
+            start.elapsed()
+        })
+        .collect();
+    println!(
+        "{:<28} p50 {:>9.1?} p95 {:>9.1?} p99 {:>9.1?}",
+        name,
+        percentile(&mut samples, 0.5),
+        percentile(&mut samples, 0.95),
+        percentile(&mut samples, 0.99)
+    );
+}
+
+fn compare<T: FromStr + FromBytes + ToBytes + ToString + PartialEq + std::fmt::Debug>(name: &str, value: &T)
+where
+    <T as FromStr>::Err: std::fmt::Debug,
+{
+    let string = value.to_string();
+    let bytes = value.to_bytes_le().unwrap();
+    println!("{}: {} string bytes, {} binary bytes", name, string.len(), bytes.len());
+
+    // Both forms must round-trip to the same value
+    assert_eq!(T::from_str(&string).unwrap(), *value);
+    assert_eq!(T::from_bytes_le(&bytes).unwrap(), *value);
+
+    measure(&format!("{} from_str", name), || {
+        T::from_str(&string).unwrap();
+    });
+    measure(&format!("{} from_bytes_le", name), || {
+        T::from_bytes_le(&bytes).unwrap();
+    });
+    measure(&format!("{} to_string", name), || {
+        value.to_string();
+    });
+    let mut out = vec![0u8; bytes.len()];
+    measure(&format!("{} write_le", name), || {
+        value.write_le(&mut out[..]).unwrap();
+    });
+}
+
+fn main() {
+    let rng = &mut rand::thread_rng();
+    let private_key = PrivateKey::<CurrentNetwork>::new(rng).unwrap();
+    let view_key = ViewKey::try_from(&private_key).unwrap();
+    let address = Address::try_from(&private_key).unwrap();
+
+    compare("PrivateKey", &private_key);
+    compare("ViewKey", &view_key);
+    compare("Address", &address);
+}
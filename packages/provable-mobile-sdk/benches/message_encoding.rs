@@ -0,0 +1,95 @@
+//! Cost of packing message bytes into field elements, the bit expansion
+//! `sign_bytes` and `verify_bytes` repeat on every call, against signing and
+//! verifying fields packed once ahead of time, by message size. Run with
+//! `cargo bench --bench message_encoding`.
+
+use std::time::{Duration, Instant};
+
+use provable_mobile_sdk::signing::{SigningContext, SigningKey};
+use snarkvm_console::{
+    account::{Address, PrivateKey},
+    network::MainnetV0,
+    prelude::{FromBits, SizeInDataBits, ToBits},
+    types::Field,
+};
+
+type CurrentNetwork = MainnetV0;
+
+const ITERATIONS: usize = 300;
+const MESSAGE_SIZES: [usize; 5] = [32, 256, 1024, 4096, 16384];
+
+fn percentile(samples: &mut [Duration], p: f64) -> Duration {
+    samples.sort_unstable();
+    samples[((samples.len() - 1) as f64 * p).round() as usize]
+}
+
+fn measure(name: &str, mut f: impl FnMut()) -> Duration {
+    // Warm caches and lazily initialized network parameters first
+    for _ in 0..ITERATIONS / 10 {
+        f();
+    }
+    let mut samples: Vec<Duration> = (0..ITERATIONS)
+        .map(|_| {
+            let start = Instant::now();
+            f();
+            start.elapsed()
+        })
+        .collect();
+    let p50 = percentile(&mut samples, 0.5);
+    println!(
+        "{:<28} p50 {:>9.1?} p95 {:>9.1?} p99 {:>9.1?}",
+        name,
+        p50,
+        percentile(&mut samples, 0.95),
+        percentile(&mut samples, 0.99)
+    );
+    p50
+}
+
+// The packing `sign_bytes` applies: little-endian bits, split into chunks of the field's data bits
+fn encode(message: &[u8]) -> Vec<Field<CurrentNetwork>> {
+    message.to_bits_le().chunks(Field::<CurrentNetwork>::size_in_data_bits()).map(|bits| Field::from_bits_le(bits).unwrap()).collect()
+}
+
+fn main() {
+    let rng = &mut rand::thread_rng();
+    let private_key = PrivateKey::<CurrentNetwork>::new(rng).unwrap();
+    let address = Address::try_from(&private_key).unwrap();
+    let signing_key = SigningKey::new(private_key);
+    let context = SigningContext::<CurrentNetwork>::new();
+    let mut preimage = Vec::new();
+
+    for size in MESSAGE_SIZES {
+        let message: Vec<u8> = (0..size).map(|i| i as u8).collect();
+        let fields = encode(&message);
+        println!("{} bytes, {} fields", size, fields.len());
+
+        // Fields packed here must be interchangeable with the bytes they came from
+        let signature = context.sign_fields(&signing_key, &fields, rng).unwrap();
+        assert!(context.verify_bytes(&signature, &address, &message));
+        assert!(context.verify_fields(&context.sign_bytes(&signing_key, &message, rng).unwrap(), &address, &fields));
+
+        let encoding = measure(&format!("encode/{}", size), || {
+            encode(&message);
+        });
+        let sign_bytes = measure(&format!("sign_bytes/{}", size), || {
+            let (nonce, commitment) = context.nonce_commitment(rng);
+            context.sign_bytes_with_nonce(&signing_key, &message, &mut preimage, nonce, commitment).unwrap();
+        });
+        measure(&format!("sign_fields/{}", size), || {
+            let (nonce, commitment) = context.nonce_commitment(rng);
+            context.sign_fields_with_nonce(&signing_key, &fields, &mut preimage, nonce, commitment).unwrap();
+        });
+        let verify_bytes = measure(&format!("verify_bytes/{}", size), || {
+            assert!(context.verify_bytes(&signature, &address, &message));
+        });
+        measure(&format!("verify_fields/{}", size), || {
+            assert!(context.verify_fields(&signature, &address, &fields));
+        });
+        println!(
+            "encoding share: {:.1}% of sign_bytes, {:.1}% of verify_bytes",
+            100.0 * encoding.as_secs_f64() / sign_bytes.as_secs_f64(),
+            100.0 * encoding.as_secs_f64() / verify_bytes.as_secs_f64()
+        );
+    }
+}
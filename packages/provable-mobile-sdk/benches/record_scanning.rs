@@ -0,0 +1,78 @@
+//! Records per second of `scan_records` over synthetic record ciphertexts,
+//! one in ten owned by the scanning view key, on every core and on one.
+//! Run with `cargo bench --bench record_scanning`.
+
+use std::str::FromStr;
+use std::time::Instant;
+
+use provable_mobile_sdk::records::scan_records;
+use snarkvm_console::{
+    account::{Address, PrivateKey, ViewKey},
+    network::{MainnetV0, Network},
+    prelude::Uniform,
+    program::{Ciphertext, Plaintext, Record},
+    types::Scalar,
+};
+
+type CurrentNetwork = MainnetV0;
+
+const RECORD_COUNT: usize = 2000;
+const CHUNK_SIZE: usize = 256;
+const OWNED_EVERY: usize = 10;
+
+fn encrypted_record(owner: &Address<CurrentNetwork>, microcredits: u64, rng: &mut impl rand::Rng) -> String {
+    let randomizer = Scalar::<CurrentNetwork>::rand(rng);
+    let nonce = CurrentNetwork::g_scalar_multiply(&randomizer);
+    let record = Record::<CurrentNetwork, Plaintext<CurrentNetwork>>::from_str(&format!(
+        "{{ owner: {owner}.private, microcredits: {microcredits}u64.private, _nonce: {nonce}.public }}"
+    ))
+    .unwrap();
+    let ciphertext: Record<CurrentNetwork, Ciphertext<CurrentNetwork>> = record.encrypt(randomizer).unwrap();
+    ciphertext.to_string()
+}
+
+fn measure(name: &str, f: impl Fn() -> usize) {
+    // Warm lazily initialized network parameters and the thread pool first
+    f();
+    let start = Instant::now();
+    let matches = f();
+    let elapsed = start.elapsed();
+    println!(
+        "{:<24} {:>10.1?} {:>8.0} records/s ({} owned)",
+        name,
+        elapsed,
+        RECORD_COUNT as f64 / elapsed.as_secs_f64(),
+        matches
+    );
+}
+
+fn main() {
+    let rng = &mut rand::thread_rng();
+    let private_key = PrivateKey::<CurrentNetwork>::new(rng).unwrap();
+    let view_key = ViewKey::try_from(&private_key).unwrap();
+    let address = Address::try_from(&private_key).unwrap();
+    let address_x = address.to_x_coordinate();
+    let stranger = Address::try_from(&PrivateKey::<CurrentNetwork>::new(rng).unwrap()).unwrap();
+
+    let records: Vec<String> = (0..RECORD_COUNT)
+        .map(|i| encrypted_record(if i % OWNED_EVERY == 0 { &address } else { &stranger }, i as u64, rng))
+        .collect();
+    let entries: Vec<&[u8]> = records.iter().map(|record| record.as_bytes()).collect();
+
+    // Exactly the owned records are found, in order, and decrypt to what was encrypted
+    let owned = scan_records(&view_key, &address_x, &entries);
+    let indices: Vec<usize> = owned.iter().map(|(index, _)| *index as usize).collect();
+    assert_eq!(indices, (0..RECORD_COUNT).step_by(OWNED_EVERY).collect::<Vec<_>>());
+    for (index, plaintext) in &owned {
+        assert!(plaintext.contains(&format!("microcredits: {index}u64.private")));
+    }
+    // Malformed entries are skipped rather than failing the scan
+    assert!(scan_records(&view_key, &address_x, &[b"record1invalid".as_slice(), b"".as_slice()]).is_empty());
+
+    measure("scan (all cores)", || scan_records(&view_key, &address_x, &entries).len());
+    measure(&format!("scan ({CHUNK_SIZE}-record chunks)"), || {
+        entries.chunks(CHUNK_SIZE).map(|chunk| scan_records(&view_key, &address_x, chunk).len()).sum()
+    });
+    let single = rayon::ThreadPoolBuilder::new().num_threads(1).build().unwrap();
+    measure("scan (one core)", || single.install(|| scan_records(&view_key, &address_x, &entries).len()));
+}
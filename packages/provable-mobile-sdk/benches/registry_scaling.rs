@@ -0,0 +1,100 @@
+//! Multi-threaded throughput of the handle registry against the previous
+//! `Mutex<HashMap>` storage. Run with `cargo bench --bench registry_scaling`.
+
+use std::collections::HashMap;
+use std::sync::{Arc, Barrier, Mutex};
+use std::thread;
+use std::time::{Duration, Instant};
+
+use provable_mobile_sdk::registry::Registry;
+
+const OPS_PER_THREAD: usize = 200_000;
+const LOOKUPS_PER_INSERT: usize = 4;
+
+trait Storage: Send + Sync + 'static {
+    fn insert(&self, value: [u8; 64]) -> u64;
+    fn get(&self, id: u64) -> bool;
+    fn remove(&self, id: u64);
+}
+
+impl Storage for Registry<[u8; 64]> {
+    fn insert(&self, value: [u8; 64]) -> u64 {
+        Registry::insert(self, value)
+    }
+
+    fn get(&self, id: u64) -> bool {
+        Registry::get(self, id).is_some()
+    }
+
+    fn remove(&self, id: u64) {
+        Registry::remove(self, id);
+    }
+}
+
+struct MutexMap {
+    map: Mutex<HashMap<u64, [u8; 64]>>,
+    next_id: Mutex<u64>,
+}
+
+impl Storage for MutexMap {
+    fn insert(&self, value: [u8; 64]) -> u64 {
+        let id = {
+            let mut next_id = self.next_id.lock().unwrap();
+            *next_id += 1;
+            *next_id
+        };
+        self.map.lock().unwrap().insert(id, value);
+        id
+    }
+
+    fn get(&self, id: u64) -> bool {
+        self.map.lock().unwrap().get(&id).is_some()
+    }
+
+    fn remove(&self, id: u64) {
+        self.map.lock().unwrap().remove(&id);
+    }
+}
+
+fn run<S: Storage>(storage: Arc<S>, threads: usize) -> Duration {
+    let barrier = Arc::new(Barrier::new(threads + 1));
+    let workers: Vec<_> = (0..threads)
+        .map(|_| {
+            let storage = storage.clone();
+            let barrier = barrier.clone();
+            thread::spawn(move || {
+                barrier.wait();
+                for i in 0..OPS_PER_THREAD {
+                    let id = storage.insert([i as u8; 64]);
+                    for _ in 0..LOOKUPS_PER_INSERT {
+                        assert!(storage.get(id));
+                    }
+                    storage.remove(id);
+                }
+            })
+        })
+        .collect();
+
+    barrier.wait();
+    let start = Instant::now();
+    for worker in workers {
+        worker.join().unwrap();
+    }
+    start.elapsed()
+}
+
+fn main() {
+    let cores = thread::available_parallelism().map(|n| n.get()).unwrap_or(1);
+    let mut counts: Vec<usize> = std::iter::successors(Some(1), |n| Some(n * 2)).take_while(|n| *n < cores).collect();
+    counts.push(cores);
+
+    println!("{:>8} {:>16} {:>16} {:>8}", "threads", "registry ops/s", "mutex ops/s", "speedup");
+    for threads in counts {
+        let ops = (threads * OPS_PER_THREAD * (LOOKUPS_PER_INSERT + 2)) as f64;
+        let registry = run(Arc::new(Registry::<[u8; 64]>::new()), threads);
+        let mutex = run(Arc::new(MutexMap { map: Mutex::new(HashMap::new()), next_id: Mutex::new(0) }), threads);
+        let registry_rate = ops / registry.as_secs_f64();
+        let mutex_rate = ops / mutex.as_secs_f64();
+        println!("{:>8} {:>16.0} {:>16.0} {:>7.2}x", threads, registry_rate, mutex_rate, registry_rate / mutex_rate);
+    }
+}
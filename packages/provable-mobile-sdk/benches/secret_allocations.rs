@@ -0,0 +1,105 @@
+//! Heap allocations per parse and format of private and view key strings,
+//! comparing the snarkvm `FromStr` and `Display` impls with the arena-backed
+//! `secure` functions the bridge uses. Formatting through `secure` should
+//! report zero allocations, and parsing only what deriving the key's scalars
+//! allocates. Run with `cargo bench --bench secret_allocations`.
+
+use std::alloc::{GlobalAlloc, Layout, System};
+use std::str::FromStr;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::time::Instant;
+
+use provable_mobile_sdk::secure::{self, SLOT_SIZE};
+use snarkvm_console::{
+    account::{PrivateKey, ViewKey},
+    network::MainnetV0,
+};
+
+type CurrentNetwork = MainnetV0;
+
+const ITERATIONS: usize = 2_000;
+
+// Counts every allocation and reallocation made by the process
+struct CountingAllocator;
+
+static ALLOCATIONS: AtomicU64 = AtomicU64::new(0);
+
+unsafe impl GlobalAlloc for CountingAllocator {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+        System.alloc(layout)
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        System.dealloc(ptr, layout)
+    }
+
+    unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+        ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+        System.realloc(ptr, layout, new_size)
+    }
+}
+
+#[global_allocator]
+static GLOBAL: CountingAllocator = CountingAllocator;
+
+fn measure(name: &str, mut f: impl FnMut()) {
+    // Lease the arena and initialize lazily built network parameters first
+    for _ in 0..ITERATIONS / 10 {
+        f();
+    }
+    let allocations = ALLOCATIONS.load(Ordering::Relaxed);
+    let start = Instant::now();
+    for _ in 0..ITERATIONS {
+        f();
+    }
+    let elapsed = start.elapsed();
+    println!(
+        "{:<28} {:>9.1?}/op {:>7.2} allocations/op",
+        name,
+        elapsed / ITERATIONS as u32,
+        (ALLOCATIONS.load(Ordering::Relaxed) - allocations) as f64 / ITERATIONS as f64
+    );
+}
+
+fn main() {
+    let private_key = PrivateKey::<CurrentNetwork>::new(&mut rand::thread_rng()).unwrap();
+    let view_key = ViewKey::try_from(&private_key).unwrap();
+    let private_key_string = private_key.to_string();
+    let view_key_string = view_key.to_string();
+    let mut out = [0u8; SLOT_SIZE];
+
+    // The arena-backed codecs must agree with snarkvm's in both directions
+    let length = secure::write_private_key(&private_key, &mut out).unwrap();
+    assert_eq!(&out[..length], private_key_string.as_bytes());
+    let length = secure::write_view_key(&view_key, &mut out).unwrap();
+    assert_eq!(&out[..length], view_key_string.as_bytes());
+    assert!(secure::parse_private_key::<CurrentNetwork>(&private_key_string) == Some(private_key));
+    assert!(secure::parse_view_key::<CurrentNetwork>(&view_key_string) == Some(view_key));
+    println!("arena locked: {}", secure::arena_locked());
+
+    measure("PrivateKey::from_str", || {
+        PrivateKey::<CurrentNetwork>::from_str(&private_key_string).unwrap();
+    });
+    measure("secure::parse_private_key", || {
+        secure::parse_private_key::<CurrentNetwork>(&private_key_string).unwrap();
+    });
+    measure("PrivateKey::to_string", || {
+        private_key.to_string();
+    });
+    measure("secure::write_private_key", || {
+        secure::write_private_key(&private_key, &mut out).unwrap();
+    });
+    measure("ViewKey::from_str", || {
+        ViewKey::<CurrentNetwork>::from_str(&view_key_string).unwrap();
+    });
+    measure("secure::parse_view_key", || {
+        secure::parse_view_key::<CurrentNetwork>(&view_key_string).unwrap();
+    });
+    measure("ViewKey::to_string", || {
+        view_key.to_string();
+    });
+    measure("secure::write_view_key", || {
+        secure::write_view_key(&view_key, &mut out).unwrap();
+    });
+}
@@ -0,0 +1,92 @@
+//! Heap allocations and throughput per signature. `sign_bytes_with` plus
+//! `write_le` into a fixed buffer is the path the bridge's `private_key_sign`
+//! takes, and should report zero allocations once warmed up. Run with
+//! `cargo bench --bench sign_allocations`.
+
+use std::alloc::{GlobalAlloc, Layout, System};
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::time::Instant;
+
+use provable_mobile_sdk::signing::{SigningContext, SigningKey};
+use snarkvm_console::{
+    account::{Address, PrivateKey, Signature},
+    network::MainnetV0,
+    prelude::{FromBytes, SizeInBytes, ToBytes},
+    types::{Field, Scalar},
+};
+
+type CurrentNetwork = MainnetV0;
+
+const ITERATIONS: usize = 500;
+const MESSAGE_SIZE: usize = 256;
+
+// Counts every allocation and reallocation made by the process
+struct CountingAllocator;
+
+static ALLOCATIONS: AtomicU64 = AtomicU64::new(0);
+
+unsafe impl GlobalAlloc for CountingAllocator {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+        System.alloc(layout)
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        System.dealloc(ptr, layout)
+    }
+
+    unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+        ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+        System.realloc(ptr, layout, new_size)
+    }
+}
+
+#[global_allocator]
+static GLOBAL: CountingAllocator = CountingAllocator;
+
+fn measure(name: &str, mut f: impl FnMut()) {
+    // Warm caches, lazily initialized network parameters and reused buffers first
+    for _ in 0..ITERATIONS / 10 {
+        f();
+    }
+    let allocations = ALLOCATIONS.load(Ordering::Relaxed);
+    let start = Instant::now();
+    for _ in 0..ITERATIONS {
+        f();
+    }
+    let elapsed = start.elapsed();
+    println!(
+        "{:<32} {:>9.1?}/sig {:>8.0} sig/s {:>7.2} allocations/sig",
+        name,
+        elapsed / ITERATIONS as u32,
+        ITERATIONS as f64 / elapsed.as_secs_f64(),
+        (ALLOCATIONS.load(Ordering::Relaxed) - allocations) as f64 / ITERATIONS as f64
+    );
+}
+
+fn main() {
+    let rng = &mut rand::thread_rng();
+    let private_key = PrivateKey::<CurrentNetwork>::new(rng).unwrap();
+    let address = Address::try_from(&private_key).unwrap();
+    let signing_key = SigningKey::new(private_key);
+    let message = vec![7u8; MESSAGE_SIZE];
+    let context = SigningContext::<CurrentNetwork>::new();
+
+    let mut preimage = Vec::new();
+    let mut output = [0u8; 2 * 32 + 2 * 32];
+    assert_eq!(output.len(), 2 * Scalar::<CurrentNetwork>::size_in_bytes() + 2 * Field::<CurrentNetwork>::size_in_bytes());
+
+    // The reused preimage must not change what gets signed
+    context.sign_bytes_with(&signing_key, &message, &mut preimage, rng).unwrap().write_le(&mut output[..]).unwrap();
+    assert!(Signature::<CurrentNetwork>::read_le(&output[..]).unwrap().verify_bytes(&address, &message));
+
+    measure("PrivateKey::sign_bytes", || {
+        private_key.sign_bytes(&message, rng).unwrap();
+    });
+    measure("SigningContext::sign_bytes", || {
+        context.sign_bytes(&signing_key, &message, rng).unwrap();
+    });
+    measure("SigningContext::sign_bytes_with", || {
+        context.sign_bytes_with(&signing_key, &message, &mut preimage, rng).unwrap().write_le(&mut output[..]).unwrap();
+    });
+}
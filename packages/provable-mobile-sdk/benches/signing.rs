@@ -0,0 +1,96 @@
+//! Single-signature latency of `PrivateKey::sign_bytes` against the
+//! precomputed `SigningContext`. Run with `cargo bench --bench signing`.
+
+use std::time::{Duration, Instant};
+
+use provable_mobile_sdk::signing::{SigningContext, SigningKey};
+use snarkvm_console::{
+    account::{Address, PrivateKey},
+    network::{MainnetV0, Network},
+    prelude::{Uniform, Zero},
+    types::Scalar,
+};
+
+type CurrentNetwork = MainnetV0;
+
+const ITERATIONS: usize = 500;
+const MESSAGE_SIZE: usize = 256;
+
+fn percentile(samples: &mut [Duration], p: f64) -> Duration {
+    samples.sort_unstable();
+    samples[((samples.len() - 1) as f64 * p).round() as usize]
+}
+
+fn measure(name: &str, mut f: impl FnMut()) {
+    // Warm caches and lazily initialized network parameters first
+    for _ in 0..ITERATIONS / 10 {
+        f();
+    }
+    let mut samples: Vec<Duration> = (0..ITERATIONS)
+        .map(|_| {
+            let start = Instant::now();
+            f();
+            start.elapsed()
+        })
+        .collect();
+    println!(
+        "{:<28} p50 {:>9.1?} p95 {:>9.1?} p99 {:>9.1?}",
+        name,
+        percentile(&mut samples, 0.5),
+        percentile(&mut samples, 0.95),
+        percentile(&mut samples, 0.99)
+    );
+}
+
+fn main() {
+    let rng = &mut rand::thread_rng();
+    let private_key = PrivateKey::<CurrentNetwork>::new(rng).unwrap();
+    let address = Address::try_from(&private_key).unwrap();
+    let signing_key = SigningKey::new(private_key);
+    let message = vec![7u8; MESSAGE_SIZE];
+
+    let start = Instant::now();
+    let context = SigningContext::<CurrentNetwork>::new();
+    println!("table construction: {:?}", start.elapsed());
+
+    // Both paths must produce signatures the other accepts
+    let signature = context.sign_bytes(&signing_key, &message, rng).unwrap();
+    assert!(signature.verify_bytes(&address, &message));
+    assert!(context.verify_bytes(&private_key.sign_bytes(&message, rng).unwrap(), &address, &message));
+    assert_eq!(context.address(&private_key).unwrap(), address);
+    // The constant-time and public-scalar multiplications must agree with snarkvm's, including on a zero scalar
+    for scalar in [Scalar::<CurrentNetwork>::rand(rng), Scalar::zero()] {
+        assert_eq!(context.g_scalar_multiply(&scalar), CurrentNetwork::g_scalar_multiply(&scalar));
+        assert_eq!(context.g_scalar_multiply_public(&scalar), CurrentNetwork::g_scalar_multiply(&scalar));
+    }
+
+    measure("sign_bytes", || {
+        private_key.sign_bytes(&message, rng).unwrap();
+    });
+    measure("SigningContext::sign_bytes", || {
+        context.sign_bytes(&signing_key, &message, rng).unwrap();
+    });
+    // A key's first signature also derives the compute key and address it caches for later ones
+    measure("SigningContext::sign_bytes (new key)", || {
+        context.sign_bytes(&SigningKey::new(private_key), &message, rng).unwrap();
+    });
+    let scalar = Scalar::<CurrentNetwork>::rand(rng);
+    measure("g_scalar_multiply", || {
+        context.g_scalar_multiply(&scalar);
+    });
+    measure("g_scalar_multiply_public", || {
+        context.g_scalar_multiply_public(&scalar);
+    });
+    measure("Address::try_from", || {
+        Address::try_from(&private_key).unwrap();
+    });
+    measure("SigningContext::address", || {
+        context.address(&private_key).unwrap();
+    });
+    measure("verify_bytes", || {
+        assert!(signature.verify_bytes(&address, &message));
+    });
+    measure("SigningContext::verify_bytes", || {
+        assert!(context.verify_bytes(&signature, &address, &message));
+    });
+}
@@ -0,0 +1,82 @@
+//! Time and peak heap use of streaming signatures over 1, 16 and 128 MB
+//! payloads, against one-shot `sign_bytes` where the payload still fits in a
+//! single message. Run with `cargo bench --bench streaming`.
+
+use std::alloc::{GlobalAlloc, Layout, System};
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::time::Instant;
+
+use provable_mobile_sdk::signing::{SigningContext, SigningKey};
+use provable_mobile_sdk::stream::{signed_message, StreamHasher};
+use snarkvm_console::{
+    account::{Address, PrivateKey},
+    network::MainnetV0,
+};
+
+type CurrentNetwork = MainnetV0;
+
+const MB: usize = 1 << 20;
+const CHUNK_SIZE: usize = 64 * 1024;
+
+// Tracks live and peak heap bytes so the benchmark can report memory as well as time
+struct CountingAllocator;
+
+static LIVE: AtomicUsize = AtomicUsize::new(0);
+static PEAK: AtomicUsize = AtomicUsize::new(0);
+
+unsafe impl GlobalAlloc for CountingAllocator {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        let live = LIVE.fetch_add(layout.size(), Ordering::Relaxed) + layout.size();
+        PEAK.fetch_max(live, Ordering::Relaxed);
+        System.alloc(layout)
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        LIVE.fetch_sub(layout.size(), Ordering::Relaxed);
+        System.dealloc(ptr, layout)
+    }
+}
+
+#[global_allocator]
+static ALLOCATOR: CountingAllocator = CountingAllocator;
+
+// Runs `f` and returns its result with the heap growth above the starting point
+fn measure<T>(f: impl FnOnce() -> T) -> (T, f64, usize) {
+    let baseline = LIVE.load(Ordering::Relaxed);
+    PEAK.store(baseline, Ordering::Relaxed);
+    let start = Instant::now();
+    let result = f();
+    let elapsed = start.elapsed().as_secs_f64() * 1000.0;
+    (result, elapsed, PEAK.load(Ordering::Relaxed) - baseline)
+}
+
+fn main() {
+    let rng = &mut rand::thread_rng();
+    let context = SigningContext::<CurrentNetwork>::new();
+    let private_key = PrivateKey::<CurrentNetwork>::new(rng).unwrap();
+    let address = Address::try_from(&private_key).unwrap();
+    let signing_key = SigningKey::new(private_key);
+    // The payload is generated chunk by chunk, so it never sits in memory as a whole
+    let chunk: Vec<u8> = (0..CHUNK_SIZE).map(|i| i as u8).collect();
+
+    println!("{:>6} {:>24} {:>12} {:>14}", "size", "path", "time (ms)", "peak heap (KB)");
+    for size in [MB, 16 * MB, 128 * MB] {
+        let (signature, elapsed, peak) = measure(|| {
+            let mut hasher = StreamHasher::<CurrentNetwork>::new();
+            for _ in 0..size / CHUNK_SIZE {
+                hasher.update(&chunk).unwrap();
+            }
+            let digest = hasher.finish().unwrap();
+            (digest, context.sign_fields(&signing_key, &signed_message(digest), &mut rand::thread_rng()).unwrap())
+        });
+        assert!(context.verify_fields(&signature.1, &address, &signed_message(signature.0)));
+        println!("{:>4}MB {:>24} {:>12.1} {:>14}", size / MB, "streaming (64 KB chunks)", elapsed, peak / 1024);
+
+        let payload: Vec<u8> = chunk.iter().copied().cycle().take(size).collect();
+        let (signed, elapsed, peak) = measure(|| context.sign_bytes(&signing_key, &payload, &mut rand::thread_rng()));
+        match signed {
+            Ok(_) => println!("{:>4}MB {:>24} {:>12.1} {:>14}", size / MB, "one-shot sign_bytes", elapsed, peak / 1024),
+            Err(e) => println!("{:>4}MB {:>24} {:>12} {:>14}  ({})", size / MB, "one-shot sign_bytes", "-", "-", e),
+        }
+    }
+}
@@ -0,0 +1,58 @@
+//! Vanity search throughput against the naive one-key-at-a-time loop that the
+//! JS API allowed. Run with `cargo bench --bench vanity`.
+
+use std::thread;
+use std::time::{Duration, Instant};
+
+use provable_mobile_sdk::signing::SigningContext;
+use provable_mobile_sdk::vanity::VanitySearch;
+use snarkvm_console::{
+    account::{Address, PrivateKey},
+    network::MainnetV0,
+};
+
+type CurrentNetwork = MainnetV0;
+
+const DURATION: Duration = Duration::from_secs(3);
+// Long enough that no run ever finds a match
+const UNREACHABLE_PREFIX: &str = "qqqqqqqqqqqqqqqq";
+
+fn naive_rate() -> f64 {
+    let rng = &mut rand::thread_rng();
+    let start = Instant::now();
+    let mut attempts = 0u64;
+    while start.elapsed() < DURATION {
+        let private_key = PrivateKey::<CurrentNetwork>::new(rng).unwrap();
+        let address = Address::try_from(&private_key).unwrap().to_string();
+        assert!(!address[5..].starts_with(UNREACHABLE_PREFIX));
+        attempts += 1;
+    }
+    attempts as f64 / start.elapsed().as_secs_f64()
+}
+
+fn search_rate(context: &SigningContext<CurrentNetwork>, threads: usize) -> f64 {
+    let search = VanitySearch::<CurrentNetwork>::new(UNREACHABLE_PREFIX, "").unwrap();
+    thread::scope(|scope| {
+        scope.spawn(|| {
+            thread::sleep(DURATION);
+            search.cancel();
+        });
+        assert!(search.run(context, threads).is_none());
+    });
+    search.attempts() as f64 / search.elapsed_seconds()
+}
+
+fn main() {
+    let context = SigningContext::<CurrentNetwork>::new();
+    let cores = thread::available_parallelism().map(|n| n.get()).unwrap_or(1);
+    let mut counts: Vec<usize> = std::iter::successors(Some(1), |n| Some(n * 2)).take_while(|n| *n < cores).collect();
+    counts.push(cores);
+
+    let naive = naive_rate();
+    println!("{:>8} {:>14} {:>8}", "threads", "attempts/s", "speedup");
+    println!("{:>8} {:>14.0} {:>8}", "naive", naive, "1.00x");
+    for threads in counts {
+        let rate = search_rate(&context, threads);
+        println!("{:>8} {:>14.0} {:>7.2}x", threads, rate, rate / naive);
+    }
+}
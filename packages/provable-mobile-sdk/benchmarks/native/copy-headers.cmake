@@ -0,0 +1,7 @@
+# Copies the cxx-build generated headers of a host release build into INCLUDES_DIR/rust
+file(GLOB_RECURSE CXX_BUILD_HEADERS "${CRATE_DIR}/target/release/build/*/out/cxxbridge/*.h")
+if(NOT CXX_BUILD_HEADERS)
+  message(FATAL_ERROR "Cxx-build headers not found under ${CRATE_DIR}/target/release/build")
+endif()
+file(MAKE_DIRECTORY "${INCLUDES_DIR}/rust")
+file(COPY ${CXX_BUILD_HEADERS} DESTINATION "${INCLUDES_DIR}/rust")
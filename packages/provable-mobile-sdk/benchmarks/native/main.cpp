@@ -0,0 +1,306 @@
+// Host micro-benchmarks for the native layer: every call goes through the same HybridObject implementations and cxx
+// bridge as on device, with Nitro and JSI replaced by the stubs in ./stubs. Results are printed as JSON.
+//
+//   native_benchmarks [--iterations N] [--filter SUBSTRING] [--output FILE] [--min-scaling-efficiency RATIO]
+//
+// The scaling section signs from several threads at once, each standing in for a JS runtime (the main runtime or a
+// worklet). With --min-scaling-efficiency the process fails when throughput at N runtimes (up to the core count) falls
+// below RATIO * N * the single-runtime throughput.
+
+#include "HybridAccount.hpp"
+#include "HybridAddress.hpp"
+#include "HybridPrivateKey.hpp"
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace margelo::nitro;
+using namespace margelo::nitro::provable;
+
+namespace {
+
+struct Options {
+  size_t iterations = 200;
+  std::string filter;
+  std::string output;
+  double minScalingEfficiency = 0;
+};
+
+struct Result {
+  std::string name;
+  size_t threads;
+  std::vector<double> samples;
+};
+
+struct Scaling {
+  std::string name;
+  size_t runtimes;
+  double opsPerSecond;
+  double efficiency;
+};
+
+double percentile(const std::vector<double>& sorted, double p) {
+  return sorted[static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5)];
+}
+
+// Runs `op` `iterations` times split across `threads` threads that start together, timing every call
+template <typename Op>
+Result measure(const std::string& name, size_t iterations, size_t threads, Op op) {
+  // Warm up lazily built state (tables, caches, executor threads) outside the measurement
+  for (size_t i = 0; i < std::max<size_t>(1, iterations / 20); ++i) {
+    op(i);
+  }
+
+  std::vector<std::vector<double>> samples(threads);
+  std::barrier start(static_cast<std::ptrdiff_t>(threads));
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t] {
+      start.arrive_and_wait();
+      for (size_t i = t; i < iterations; i += threads) {
+        auto begin = std::chrono::steady_clock::now();
+        op(i);
+        samples[t].push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count());
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  Result result{name, threads, {}};
+  for (auto& perThread : samples) {
+    result.samples.insert(result.samples.end(), perThread.begin(), perThread.end());
+  }
+  std::sort(result.samples.begin(), result.samples.end());
+  return result;
+}
+
+std::shared_ptr<ArrayBuffer> bytes(size_t size, uint8_t fill) {
+  auto buffer = ArrayBuffer::allocate(size);
+  std::memset(buffer->data(), fill, size);
+  return buffer;
+}
+
+std::shared_ptr<ArrayBuffer> text(const std::string& value) {
+  return ArrayBuffer::copy(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+}
+
+// Same layout as `packBatch` in the TS package
+std::shared_ptr<ArrayBuffer> pack(const std::vector<std::shared_ptr<ArrayBuffer>>& entries) {
+  size_t header = 4 * (entries.size() + 2);
+  size_t total = header;
+  for (const auto& entry : entries) {
+    total += entry->size();
+  }
+  auto packed = ArrayBuffer::allocate(total);
+  auto write = [&](size_t index, uint32_t value) { std::memcpy(packed->data() + 4 * index, &value, 4); };
+  write(0, static_cast<uint32_t>(entries.size()));
+  size_t offset = header;
+  write(1, static_cast<uint32_t>(offset));
+  for (size_t i = 0; i < entries.size(); ++i) {
+    std::memcpy(packed->data() + offset, entries[i]->data(), entries[i]->size());
+    offset += entries[i]->size();
+    write(i + 2, static_cast<uint32_t>(offset));
+  }
+  return packed;
+}
+
+// Total signatures per second with `runtimes` threads each awaiting one signature at a time for `duration`.
+// `sign` is called with the thread index and must block until its signature is done
+template <typename Sign>
+double throughput(size_t runtimes, std::chrono::milliseconds duration, Sign sign) {
+  std::atomic<bool> stop{false};
+  std::atomic<size_t> operations{0};
+  std::barrier start(static_cast<std::ptrdiff_t>(runtimes + 1));
+  std::vector<std::thread> threads;
+  for (size_t runtime = 0; runtime < runtimes; ++runtime) {
+    threads.emplace_back([&, runtime] {
+      start.arrive_and_wait();
+      size_t count = 0;
+      while (!stop) {
+        sign(runtime);
+        ++count;
+      }
+      operations += count;
+    });
+  }
+  start.arrive_and_wait();
+  auto began = std::chrono::steady_clock::now();
+  std::this_thread::sleep_for(duration);
+  stop = true;
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return static_cast<double>(operations) / std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+}
+
+std::string toJson(const std::vector<Result>& results, const std::vector<Scaling>& scaling) {
+  std::ostringstream json;
+  json << "{\n  \"benchmarks\": [";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto& result = results[i];
+    double mean = 0;
+    for (double sample : result.samples) {
+      mean += sample / static_cast<double>(result.samples.size());
+    }
+    json << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << result.name << "\", \"threads\": " << result.threads
+         << ", \"iterations\": " << result.samples.size() << ", \"mean_ns\": " << static_cast<uint64_t>(mean)
+         << ", \"min_ns\": " << static_cast<uint64_t>(result.samples.front())
+         << ", \"p50_ns\": " << static_cast<uint64_t>(percentile(result.samples, 0.5))
+         << ", \"p90_ns\": " << static_cast<uint64_t>(percentile(result.samples, 0.9))
+         << ", \"p99_ns\": " << static_cast<uint64_t>(percentile(result.samples, 0.99))
+         << ", \"max_ns\": " << static_cast<uint64_t>(result.samples.back()) << "}";
+  }
+  json << "\n  ],\n  \"scaling\": [";
+  for (size_t i = 0; i < scaling.size(); ++i) {
+    json << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << scaling[i].name << "\", \"runtimes\": " << scaling[i].runtimes
+         << ", \"ops_per_second\": " << static_cast<uint64_t>(scaling[i].opsPerSecond) << ", \"efficiency\": " << scaling[i].efficiency
+         << "}";
+  }
+  json << "\n  ]\n}\n";
+  return json.str();
+}
+
+Options parse(int argc, char** argv) {
+  Options options;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "--iterations") {
+      options.iterations = std::max(1ul, std::stoul(argv[i + 1]));
+    } else if (flag == "--filter") {
+      options.filter = argv[i + 1];
+    } else if (flag == "--output") {
+      options.output = argv[i + 1];
+    } else if (flag == "--min-scaling-efficiency") {
+      options.minScalingEfficiency = std::stod(argv[i + 1]);
+    } else {
+      throw std::invalid_argument("Unknown flag " + flag);
+    }
+  }
+  return options;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  auto options = parse(argc, argv);
+  auto account = std::make_shared<HybridAccount>();
+  auto privateKey = account->createPrivateKey();
+  auto privateKeyString = privateKey->toString();
+  auto address = account->addressFromPrivateKey(privateKey);
+  auto addressString = address->toString();
+  auto privateKeyBytes = privateKey->toBytes();
+  auto addressBytes = address->toBytes();
+  auto cores = std::max(1u, std::thread::hardware_concurrency());
+
+  std::vector<Result> results;
+  auto run = [&](const std::string& name, size_t threads, auto op) {
+    if (name.find(options.filter) == std::string::npos) {
+      return;
+    }
+    std::cerr << "running " << name << " x" << threads << std::endl;
+    results.push_back(measure(name, options.iterations, threads, op));
+  };
+
+  // Creation, parsing and derivation
+  run("account.createPrivateKey", 1, [&](size_t) { account->createPrivateKey(); });
+  run("account.privateKeyFromString", 1, [&](size_t) { account->privateKeyFromString(privateKeyString); });
+  run("account.addressFromString", 1, [&](size_t) { account->addressFromString(addressString); });
+  run("account.privateKeyFromBytes", 1, [&](size_t) { account->privateKeyFromBytes(privateKeyBytes); });
+  run("account.addressFromBytes", 1, [&](size_t) { account->addressFromBytes(addressBytes); });
+  run("account.addressFromPrivateKey", 1, [&](size_t) { account->addressFromPrivateKey(privateKey); });
+  run("account.viewKeyFromPrivateKey", 1, [&](size_t) { account->viewKeyFromPrivateKey(privateKey); });
+  run("privateKey.toAddress", 1, [&](size_t) { privateKey->toAddress()->wait(); });
+  run("privateKey.toString", 1, [&](size_t) { privateKey->toString(); });
+  run("privateKey.toBytes", 1, [&](size_t) { privateKey->toBytes(); });
+  run("address.toString", 1, [&](size_t) { address->toString(); });
+  run("address.toBytes", 1, [&](size_t) { address->toBytes(); });
+
+  // Signing and verification by message size
+  for (size_t size : {32ul, 1024ul, 16384ul}) {
+    auto message = bytes(size, 7);
+    auto signature = privateKey->sign(message, std::nullopt)->wait();
+    run("privateKey.sign/" + std::to_string(size), 1, [&](size_t) { privateKey->sign(message, std::nullopt)->wait(); });
+    run("address.verify/" + std::to_string(size), 1, [&](size_t) { address->verify(signature, message, std::nullopt)->wait(); });
+  }
+
+  // The same signatures with their nonce commitments precomputed by the nonce pool's thread
+  account->setNoncePoolSize(static_cast<double>(options.iterations), std::nullopt);
+  for (size_t size : {32ul, 1024ul, 16384ul}) {
+    auto message = bytes(size, 7);
+    run("privateKey.sign/pooled/" + std::to_string(size), 1, [&](size_t) { privateKey->sign(message, std::nullopt)->wait(); });
+  }
+  account->setNoncePoolSize(0, std::nullopt);
+
+  // Batches of 64 messages of 256 bytes
+  std::vector<std::shared_ptr<ArrayBuffer>> messages;
+  std::vector<std::shared_ptr<ArrayBuffer>> triples;
+  for (size_t i = 0; i < 64; ++i) {
+    messages.push_back(bytes(256, static_cast<uint8_t>(i)));
+  }
+  auto signatures = privateKey->signBatch(messages, std::nullopt)->wait();
+  for (size_t i = 0; i < messages.size(); ++i) {
+    uint32_t range[2];
+    std::memcpy(range, signatures->data() + 4 * (i + 1), sizeof(range));
+    triples.push_back(text(addressString));
+    triples.push_back(ArrayBuffer::copy(signatures->data() + range[0], range[1] - range[0]));
+    triples.push_back(messages[i]);
+  }
+  auto packedTriples = pack(triples);
+  run("privateKey.signBatch/64x256", 1, [&](size_t) { privateKey->signBatch(messages, std::nullopt)->wait(); });
+  run("account.verifyBatch/64x256", 1, [&](size_t) { account->verifyBatch(packedTriples, std::nullopt)->wait(); });
+
+  // Contention: the same calls from several JS runtimes (threads) at once
+  auto message = bytes(256, 7);
+  for (size_t threads = 2; threads <= cores; threads *= 2) {
+    run("contention.privateKey.sign/256", threads, [&](size_t) { privateKey->sign(message, std::nullopt)->wait(); });
+    run("contention.account.addressFromString", threads, [&](size_t) { account->addressFromString(addressString); });
+    run("contention.privateKey.toString", threads, [&](size_t) { privateKey->toString(); });
+  }
+
+  // Scaling across runtimes, either all sharing one key object or each signing with its own
+  std::vector<Scaling> scaling;
+  auto scale = [&](const std::string& name, auto sign) {
+    if (name.find(options.filter) == std::string::npos) {
+      return;
+    }
+    double single = 0;
+    for (size_t runtimes = 1; runtimes <= cores; runtimes *= 2) {
+      std::cerr << "running " << name << " x" << runtimes << std::endl;
+      double opsPerSecond = throughput(runtimes, std::chrono::milliseconds(1000), sign);
+      single = runtimes == 1 ? opsPerSecond : single;
+      scaling.push_back({name, runtimes, opsPerSecond, opsPerSecond / (single * static_cast<double>(runtimes))});
+    }
+  };
+  scale("scaling.sharedKey.sign/256", [&](size_t) { privateKey->sign(message, std::nullopt)->wait(); });
+  std::vector<std::shared_ptr<HybridPrivateKeySpec>> runtimeKeys;
+  std::vector<std::shared_ptr<ArrayBuffer>> runtimeMessages;
+  for (size_t runtime = 0; runtime < cores; ++runtime) {
+    runtimeKeys.push_back(std::make_shared<HybridAccount>()->privateKeyFromString(privateKeyString));
+    runtimeMessages.push_back(bytes(256, static_cast<uint8_t>(runtime)));
+  }
+  scale("scaling.ownKey.sign/256", [&](size_t runtime) { runtimeKeys[runtime]->sign(runtimeMessages[runtime], std::nullopt)->wait(); });
+
+  auto json = toJson(results, scaling);
+  if (options.output.empty()) {
+    std::cout << json;
+  } else {
+    std::ofstream(options.output) << json;
+  }
+
+  for (const auto& point : scaling) {
+    if (point.efficiency < options.minScalingEfficiency) {
+      std::cerr << point.name << " reached " << point.efficiency << " of linear scaling at " << point.runtimes << " runtimes" << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+// Host stub of react-native-nitro-modules' ArrayBuffer.hpp - every buffer is native-owned
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace margelo::nitro {
+
+class ArrayBuffer {
+ public:
+  virtual ~ArrayBuffer() = default;
+
+  virtual uint8_t* data() = 0;
+  virtual size_t size() const = 0;
+  virtual bool isOwner() const noexcept = 0;
+
+  static std::shared_ptr<ArrayBuffer> allocate(size_t size);
+  static std::shared_ptr<ArrayBuffer> copy(const uint8_t* data, size_t size);
+};
+
+class NativeArrayBuffer final : public ArrayBuffer {
+ public:
+  explicit NativeArrayBuffer(std::vector<uint8_t> bytes) : _bytes(std::move(bytes)) {}
+
+  uint8_t* data() override {
+    return _bytes.data();
+  }
+  size_t size() const override {
+    return _bytes.size();
+  }
+  bool isOwner() const noexcept override {
+    return true;
+  }
+
+ private:
+  std::vector<uint8_t> _bytes;
+};
+
+inline std::shared_ptr<ArrayBuffer> ArrayBuffer::allocate(size_t size) {
+  return std::make_shared<NativeArrayBuffer>(std::vector<uint8_t>(size));
+}
+
+inline std::shared_ptr<ArrayBuffer> ArrayBuffer::copy(const uint8_t* data, size_t size) {
+  return std::make_shared<NativeArrayBuffer>(std::vector<uint8_t>(data, data + size));
+}
+
+} // namespace margelo::nitro
@@ -0,0 +1,47 @@
+#pragma once
+
+// Host stub of react-native-nitro-modules' HybridObject.hpp - methods are registered into a no-op prototype
+#include "ArrayBuffer.hpp"
+#include "NitroDefines.hpp"
+#include "Promise.hpp"
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace margelo::nitro {
+
+class Prototype {
+ public:
+  template <typename Method>
+  void registerHybridMethod(const char* /* name */, Method /* method */) {}
+
+  template <typename Getter>
+  void registerHybridGetter(const char* /* name */, Getter /* getter */) {}
+
+  template <typename Setter>
+  void registerHybridSetter(const char* /* name */, Setter /* setter */) {}
+};
+
+class HybridObject : public std::enable_shared_from_this<HybridObject> {
+ public:
+  explicit HybridObject(const char* name) : _name(name) {}
+  virtual ~HybridObject() = default;
+
+  virtual std::string toString() {
+    return "[HybridObject " + std::string(_name) + "]";
+  }
+
+ protected:
+  virtual void loadHybridMethods() {}
+
+  template <typename Derived>
+  void registerHybrids(Derived* /* self */, const std::function<void(Prototype&)>& registerFunc) {
+    Prototype prototype;
+    registerFunc(prototype);
+  }
+
+ private:
+  const char* _name;
+};
+
+} // namespace margelo::nitro
@@ -0,0 +1,67 @@
+#pragma once
+
+// Host stub of react-native-nitro-modules' JSIConverter.hpp with just enough of jsi for generated struct converters
+// to compile. The benchmarks never convert values, so every operation throws.
+#include "NitroDefines.hpp"
+#include <stdexcept>
+
+namespace facebook::jsi {
+
+class Object;
+
+class Runtime {};
+
+class Value {
+ public:
+  Value() = default;
+  Value(Object&&) {}
+
+  bool isObject() const {
+    return false;
+  }
+  Object asObject(Runtime& runtime) const;
+  Object getObject(Runtime& runtime) const;
+};
+
+class Object {
+ public:
+  explicit Object(Runtime&) {}
+
+  Value getProperty(Runtime&, const char*) const {
+    throw std::logic_error("jsi is not available in host builds");
+  }
+  template <typename T>
+  void setProperty(Runtime&, const char*, T&&) {
+    throw std::logic_error("jsi is not available in host builds");
+  }
+};
+
+inline Object Value::asObject(Runtime& runtime) const {
+  throw std::logic_error("jsi is not available in host builds");
+}
+
+inline Object Value::getObject(Runtime& runtime) const {
+  throw std::logic_error("jsi is not available in host builds");
+}
+
+} // namespace facebook::jsi
+
+namespace margelo::nitro {
+
+namespace jsi = facebook::jsi;
+
+// Every type without a generated converter (primitives, ArrayBuffers, arrays, hybrid objects) shares this one
+template <typename T>
+struct JSIConverter final {
+  static inline T fromJSI(jsi::Runtime&, const jsi::Value&) {
+    throw std::logic_error("jsi is not available in host builds");
+  }
+  static inline jsi::Value toJSI(jsi::Runtime&, const T&) {
+    throw std::logic_error("jsi is not available in host builds");
+  }
+  static inline bool canConvert(jsi::Runtime&, const jsi::Value&) {
+    return false;
+  }
+};
+
+} // namespace margelo::nitro
@@ -0,0 +1,4 @@
+#pragma once
+
+// Host stub of react-native-nitro-modules' NitroDefines.hpp
+#define SWIFT_PRIVATE
@@ -0,0 +1,96 @@
+#pragma once
+
+// Host stub of react-native-nitro-modules' Promise.hpp.
+// `wait()` only exists in the stub, benchmarks use it to block on a result.
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace margelo::nitro {
+
+template <typename T>
+class Promise {
+ public:
+  static std::shared_ptr<Promise> create() {
+    return std::shared_ptr<Promise>(new Promise());
+  }
+
+  void resolve(T result) {
+    std::lock_guard lock(_mutex);
+    _result.emplace(std::move(result));
+    _settled.notify_all();
+  }
+
+  void reject(std::exception_ptr error) {
+    std::lock_guard lock(_mutex);
+    _error = error;
+    _settled.notify_all();
+  }
+
+  bool isPending() {
+    std::lock_guard lock(_mutex);
+    return !_result.has_value() && _error == nullptr;
+  }
+
+  T wait() {
+    std::unique_lock lock(_mutex);
+    _settled.wait(lock, [&] { return _result.has_value() || _error != nullptr; });
+    if (_error != nullptr) {
+      std::rethrow_exception(_error);
+    }
+    return *_result;
+  }
+
+ private:
+  Promise() = default;
+
+  std::mutex _mutex;
+  std::condition_variable _settled;
+  std::optional<T> _result;
+  std::exception_ptr _error;
+};
+
+template <>
+class Promise<void> {
+ public:
+  static std::shared_ptr<Promise> create() {
+    return std::shared_ptr<Promise>(new Promise());
+  }
+
+  void resolve() {
+    std::lock_guard lock(_mutex);
+    _resolved = true;
+    _settled.notify_all();
+  }
+
+  void reject(std::exception_ptr error) {
+    std::lock_guard lock(_mutex);
+    _error = error;
+    _settled.notify_all();
+  }
+
+  bool isPending() {
+    std::lock_guard lock(_mutex);
+    return !_resolved && _error == nullptr;
+  }
+
+  void wait() {
+    std::unique_lock lock(_mutex);
+    _settled.wait(lock, [&] { return _resolved || _error != nullptr; });
+    if (_error != nullptr) {
+      std::rethrow_exception(_error);
+    }
+  }
+
+ private:
+  Promise() = default;
+
+  std::mutex _mutex;
+  std::condition_variable _settled;
+  bool _resolved = false;
+  std::exception_ptr _error;
+};
+
+} // namespace margelo::nitro
@@ -1,14 +1,31 @@
 fn main() {
-    println!("cargo:rerun-if-changed=src/rust/lib.rs");
+    // Directories are scanned recursively, so edits to any bridged or compiled source rerun the build
+    for path in ["src/rust", "src/cpp", "nitrogen/generated", "android/src/main/cpp/cpp-adapter.cpp"] {
+        println!("cargo:rerun-if-changed={}", path);
+    }
 
     let target = std::env::var("TARGET").unwrap();
     let is_android = target.contains("android");
+    let is_mobile = is_android || target.contains("apple");
     
     let mut build = cxx_build::bridge("src/rust/lib.rs");
     
+    // Host builds (cargo bench) only need the bridge, not the Nitro sources
+    if !is_mobile {
+        build.std("c++20");
+        build.compile("provable_mobile_sdk");
+        return;
+    }
+    
     // Add the C++ files that need to be compiled
-    build.file("src/cpp/HybridAccount.cpp");
-    build.file("nitrogen/generated/shared/c++/HybridAccountSpec.cpp");
+    for dir in ["src/cpp", "nitrogen/generated/shared/c++"] {
+        for entry in std::fs::read_dir(dir).unwrap() {
+            let path = entry.unwrap().path();
+            if path.extension().is_some_and(|ext| ext == "cpp") {
+                build.file(path);
+            }
+        }
+    }
     
     if is_android {
         build.file("android/src/main/cpp/cpp-adapter.cpp");
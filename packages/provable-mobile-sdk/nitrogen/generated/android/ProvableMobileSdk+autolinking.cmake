@@ -28,6 +28,14 @@ target_sources(
   ../nitrogen/generated/android/ProvableMobileSdkOnLoad.cpp
   # Shared Nitrogen C++ sources
   ../nitrogen/generated/shared/c++/HybridAccountSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridPrivateKeySpec.cpp
+  ../nitrogen/generated/shared/c++/HybridAddressSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridViewKeySpec.cpp
+  ../nitrogen/generated/shared/c++/HybridCancellationTokenSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridVanitySearchSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridStreamingSignerSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridStreamingVerifierSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridEncodedMessageSpec.cpp
   # Android-specific Nitrogen C++ sources
   
 )
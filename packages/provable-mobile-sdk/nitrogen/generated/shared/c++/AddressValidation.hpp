@@ -0,0 +1,77 @@
+///
+/// AddressValidation.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+// Forward declaration of `HybridAddressSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridAddressSpec; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+#include <memory>
+#include "HybridAddressSpec.hpp"
+#include <vector>
+
+namespace margelo::nitro::provable {
+
+  /**
+   * A struct which can be represented as a JavaScript object (AddressValidation).
+   */
+  struct AddressValidation {
+  public:
+    std::shared_ptr<ArrayBuffer> valid     SWIFT_PRIVATE;
+    std::vector<std::shared_ptr<HybridAddressSpec>> addresses     SWIFT_PRIVATE;
+
+  public:
+    AddressValidation() = default;
+    explicit AddressValidation(std::shared_ptr<ArrayBuffer> valid, std::vector<std::shared_ptr<HybridAddressSpec>> addresses): valid(valid), addresses(addresses) {}
+  };
+
+} // namespace margelo::nitro::provable
+
+namespace margelo::nitro {
+
+  // C++ AddressValidation <> JS AddressValidation (object)
+  template <>
+  struct JSIConverter<margelo::nitro::provable::AddressValidation> final {
+    static inline margelo::nitro::provable::AddressValidation fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::provable::AddressValidation(
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "valid")),
+        JSIConverter<std::vector<std::shared_ptr<margelo::nitro::provable::HybridAddressSpec>>>::fromJSI(runtime, obj.getProperty(runtime, "addresses"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::AddressValidation& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "valid", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.valid));
+      obj.setProperty(runtime, "addresses", JSIConverter<std::vector<std::shared_ptr<margelo::nitro::provable::HybridAddressSpec>>>::toJSI(runtime, arg.addresses));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "valid"))) return false;
+      if (!JSIConverter<std::vector<std::shared_ptr<margelo::nitro::provable::HybridAddressSpec>>>::canConvert(runtime, obj.getProperty(runtime, "addresses"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,77 @@
+///
+/// DerivationCacheStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+namespace margelo::nitro::provable {
+
+  /**
+   * A struct which can be represented as a JavaScript object (DerivationCacheStats).
+   */
+  struct DerivationCacheStats {
+  public:
+    double hits     SWIFT_PRIVATE;
+    double misses     SWIFT_PRIVATE;
+    double size     SWIFT_PRIVATE;
+    double capacity     SWIFT_PRIVATE;
+
+  public:
+    DerivationCacheStats() = default;
+    explicit DerivationCacheStats(double hits, double misses, double size, double capacity): hits(hits), misses(misses), size(size), capacity(capacity) {}
+  };
+
+} // namespace margelo::nitro::provable
+
+namespace margelo::nitro {
+
+  // C++ DerivationCacheStats <> JS DerivationCacheStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::provable::DerivationCacheStats> final {
+    static inline margelo::nitro::provable::DerivationCacheStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::provable::DerivationCacheStats(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "hits")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "misses")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "size")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "capacity"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::DerivationCacheStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "hits", JSIConverter<double>::toJSI(runtime, arg.hits));
+      obj.setProperty(runtime, "misses", JSIConverter<double>::toJSI(runtime, arg.misses));
+      obj.setProperty(runtime, "size", JSIConverter<double>::toJSI(runtime, arg.size));
+      obj.setProperty(runtime, "capacity", JSIConverter<double>::toJSI(runtime, arg.capacity));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "hits"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "misses"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "size"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "capacity"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -18,9 +18,34 @@ namespace margelo::nitro::provable {
       prototype.registerHybridMethod("privateKeyFromString", &HybridAccountSpec::privateKeyFromString);
       prototype.registerHybridMethod("addressFromString", &HybridAccountSpec::addressFromString);
       prototype.registerHybridMethod("viewKeyFromString", &HybridAccountSpec::viewKeyFromString);
+      prototype.registerHybridMethod("privateKeyFromBytes", &HybridAccountSpec::privateKeyFromBytes);
+      prototype.registerHybridMethod("addressFromBytes", &HybridAccountSpec::addressFromBytes);
+      prototype.registerHybridMethod("viewKeyFromBytes", &HybridAccountSpec::viewKeyFromBytes);
       prototype.registerHybridMethod("addressFromPrivateKey", &HybridAccountSpec::addressFromPrivateKey);
       prototype.registerHybridMethod("viewKeyFromPrivateKey", &HybridAccountSpec::viewKeyFromPrivateKey);
       prototype.registerHybridMethod("addressFromViewKey", &HybridAccountSpec::addressFromViewKey);
+      prototype.registerHybridMethod("encodeMessage", &HybridAccountSpec::encodeMessage);
+      prototype.registerHybridMethod("encodedMessageFromFields", &HybridAccountSpec::encodedMessageFromFields);
+      prototype.registerHybridMethod("verifyBatch", &HybridAccountSpec::verifyBatch);
+      prototype.registerHybridMethod("validateAddresses", &HybridAccountSpec::validateAddresses);
+      prototype.registerHybridMethod("validatePrivateKeys", &HybridAccountSpec::validatePrivateKeys);
+      prototype.registerHybridMethod("validateViewKeys", &HybridAccountSpec::validateViewKeys);
+      prototype.registerHybridMethod("createCancellationToken", &HybridAccountSpec::createCancellationToken);
+      prototype.registerHybridMethod("setMaxQueuedJobs", &HybridAccountSpec::setMaxQueuedJobs);
+      prototype.registerHybridMethod("setDerivationCacheSize", &HybridAccountSpec::setDerivationCacheSize);
+      prototype.registerHybridMethod("getDerivationCacheStats", &HybridAccountSpec::getDerivationCacheStats);
+      prototype.registerHybridMethod("setAddressCacheSize", &HybridAccountSpec::setAddressCacheSize);
+      prototype.registerHybridMethod("warmAddressCache", &HybridAccountSpec::warmAddressCache);
+      prototype.registerHybridMethod("setNoncePoolSize", &HybridAccountSpec::setNoncePoolSize);
+      prototype.registerHybridMethod("getNoncePoolStats", &HybridAccountSpec::getNoncePoolStats);
+      prototype.registerHybridMethod("prepareSigningContext", &HybridAccountSpec::prepareSigningContext);
+      prototype.registerHybridMethod("warmUp", &HybridAccountSpec::warmUp);
+      prototype.registerHybridMethod("deriveAccounts", &HybridAccountSpec::deriveAccounts);
+      prototype.registerHybridMethod("restoreAccounts", &HybridAccountSpec::restoreAccounts);
+      prototype.registerHybridMethod("startVanitySearch", &HybridAccountSpec::startVanitySearch);
+      prototype.registerHybridMethod("setStatsEnabled", &HybridAccountSpec::setStatsEnabled);
+      prototype.registerHybridMethod("getStats", &HybridAccountSpec::getStats);
+      prototype.registerHybridMethod("resetStats", &HybridAccountSpec::resetStats);
     });
   }
 
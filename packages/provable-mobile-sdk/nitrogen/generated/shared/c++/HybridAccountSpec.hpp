@@ -13,17 +13,57 @@
 #error NitroModules cannot be found! Are you sure you installed NitroModules properly?
 #endif
 
-// Forward declaration of `PrivateKey` to properly resolve imports.
-namespace margelo::nitro::provable { struct PrivateKey; }
-// Forward declaration of `Address` to properly resolve imports.
-namespace margelo::nitro::provable { struct Address; }
-// Forward declaration of `ViewKey` to properly resolve imports.
-namespace margelo::nitro::provable { struct ViewKey; }
+// Forward declaration of `HybridPrivateKeySpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridPrivateKeySpec; }
+// Forward declaration of `HybridAddressSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridAddressSpec; }
+// Forward declaration of `HybridViewKeySpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridViewKeySpec; }
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+// Forward declaration of `HybridEncodedMessageSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridEncodedMessageSpec; }
+// Forward declaration of `HybridCancellationTokenSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridCancellationTokenSpec; }
+// Forward declaration of `AddressValidation` to properly resolve imports.
+namespace margelo::nitro::provable { struct AddressValidation; }
+// Forward declaration of `PrivateKeyValidation` to properly resolve imports.
+namespace margelo::nitro::provable { struct PrivateKeyValidation; }
+// Forward declaration of `ViewKeyValidation` to properly resolve imports.
+namespace margelo::nitro::provable { struct ViewKeyValidation; }
+// Forward declaration of `WarmUpStats` to properly resolve imports.
+namespace margelo::nitro::provable { struct WarmUpStats; }
+// Forward declaration of `RestoredAccounts` to properly resolve imports.
+namespace margelo::nitro::provable { struct RestoredAccounts; }
+// Forward declaration of `HybridVanitySearchSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridVanitySearchSpec; }
+// Forward declaration of `DerivationCacheStats` to properly resolve imports.
+namespace margelo::nitro::provable { struct DerivationCacheStats; }
+// Forward declaration of `NoncePoolStats` to properly resolve imports.
+namespace margelo::nitro::provable { struct NoncePoolStats; }
+// Forward declaration of `SdkStats` to properly resolve imports.
+namespace margelo::nitro::provable { struct SdkStats; }
 
-#include "PrivateKey.hpp"
+#include <memory>
+#include "HybridPrivateKeySpec.hpp"
 #include <string>
-#include "Address.hpp"
-#include "ViewKey.hpp"
+#include "HybridAddressSpec.hpp"
+#include "HybridViewKeySpec.hpp"
+#include <NitroModules/Promise.hpp>
+#include <NitroModules/ArrayBuffer.hpp>
+#include "HybridEncodedMessageSpec.hpp"
+#include "HybridCancellationTokenSpec.hpp"
+#include <optional>
+#include "AddressValidation.hpp"
+#include "PrivateKeyValidation.hpp"
+#include "ViewKeyValidation.hpp"
+#include "DerivationCacheStats.hpp"
+#include "NoncePoolStats.hpp"
+#include <vector>
+#include "WarmUpStats.hpp"
+#include "RestoredAccounts.hpp"
+#include "HybridVanitySearchSpec.hpp"
+#include "SdkStats.hpp"
 
 namespace margelo::nitro::provable {
 
@@ -56,13 +96,38 @@ namespace margelo::nitro::provable {
 
     public:
       // Methods
-      virtual PrivateKey createPrivateKey() = 0;
-      virtual PrivateKey privateKeyFromString(const std::string& privateKey) = 0;
-      virtual Address addressFromString(const std::string& address) = 0;
-      virtual ViewKey viewKeyFromString(const std::string& viewKey) = 0;
-      virtual Address addressFromPrivateKey(const PrivateKey& privateKey) = 0;
-      virtual ViewKey viewKeyFromPrivateKey(const PrivateKey& privateKey) = 0;
-      virtual Address addressFromViewKey(const ViewKey& viewKey) = 0;
+      virtual std::shared_ptr<HybridPrivateKeySpec> createPrivateKey() = 0;
+      virtual std::shared_ptr<HybridPrivateKeySpec> privateKeyFromString(const std::string& privateKey) = 0;
+      virtual std::shared_ptr<HybridAddressSpec> addressFromString(const std::string& address) = 0;
+      virtual std::shared_ptr<HybridViewKeySpec> viewKeyFromString(const std::string& viewKey) = 0;
+      virtual std::shared_ptr<HybridPrivateKeySpec> privateKeyFromBytes(const std::shared_ptr<ArrayBuffer>& bytes) = 0;
+      virtual std::shared_ptr<HybridAddressSpec> addressFromBytes(const std::shared_ptr<ArrayBuffer>& bytes) = 0;
+      virtual std::shared_ptr<HybridViewKeySpec> viewKeyFromBytes(const std::shared_ptr<ArrayBuffer>& bytes) = 0;
+      virtual std::shared_ptr<HybridAddressSpec> addressFromPrivateKey(const std::shared_ptr<HybridPrivateKeySpec>& privateKey) = 0;
+      virtual std::shared_ptr<HybridViewKeySpec> viewKeyFromPrivateKey(const std::shared_ptr<HybridPrivateKeySpec>& privateKey) = 0;
+      virtual std::shared_ptr<HybridAddressSpec> addressFromViewKey(const std::shared_ptr<HybridViewKeySpec>& viewKey) = 0;
+      virtual std::shared_ptr<HybridEncodedMessageSpec> encodeMessage(const std::shared_ptr<ArrayBuffer>& message) = 0;
+      virtual std::shared_ptr<HybridEncodedMessageSpec> encodedMessageFromFields(const std::shared_ptr<ArrayBuffer>& fields) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> verifyBatch(const std::shared_ptr<ArrayBuffer>& triples, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+      virtual std::shared_ptr<Promise<AddressValidation>> validateAddresses(const std::shared_ptr<ArrayBuffer>& addresses, std::optional<bool> parse, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+      virtual std::shared_ptr<Promise<PrivateKeyValidation>> validatePrivateKeys(const std::shared_ptr<ArrayBuffer>& privateKeys, std::optional<bool> parse, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+      virtual std::shared_ptr<Promise<ViewKeyValidation>> validateViewKeys(const std::shared_ptr<ArrayBuffer>& viewKeys, std::optional<bool> parse, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+      virtual std::shared_ptr<HybridCancellationTokenSpec> createCancellationToken() = 0;
+      virtual void setMaxQueuedJobs(double limit) = 0;
+      virtual void setDerivationCacheSize(double size) = 0;
+      virtual DerivationCacheStats getDerivationCacheStats() = 0;
+      virtual void setAddressCacheSize(double size) = 0;
+      virtual std::shared_ptr<Promise<double>> warmAddressCache(const std::vector<std::string>& addresses) = 0;
+      virtual void setNoncePoolSize(double depth, std::optional<double> refillBelow) = 0;
+      virtual NoncePoolStats getNoncePoolStats() = 0;
+      virtual std::shared_ptr<Promise<void>> prepareSigningContext() = 0;
+      virtual std::shared_ptr<Promise<WarmUpStats>> warmUp() = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> deriveAccounts(const std::shared_ptr<ArrayBuffer>& seed, double startIndex, double count) = 0;
+      virtual std::shared_ptr<Promise<RestoredAccounts>> restoreAccounts(const std::string& path, const std::shared_ptr<ArrayBuffer>& secret, const std::vector<std::string>& privateKeys) = 0;
+      virtual std::shared_ptr<HybridVanitySearchSpec> startVanitySearch(const std::string& prefix, const std::string& suffix) = 0;
+      virtual void setStatsEnabled(bool enabled) = 0;
+      virtual SdkStats getStats() = 0;
+      virtual void resetStats() = 0;
 
     protected:
       // Hybrid Setup
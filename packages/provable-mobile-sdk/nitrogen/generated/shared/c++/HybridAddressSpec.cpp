@@ -0,0 +1,25 @@
+///
+/// HybridAddressSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridAddressSpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  void HybridAddressSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("verify", &HybridAddressSpec::verify);
+      prototype.registerHybridMethod("verifyFields", &HybridAddressSpec::verifyFields);
+      prototype.registerHybridMethod("verifyEncoded", &HybridAddressSpec::verifyEncoded);
+      prototype.registerHybridMethod("createVerifier", &HybridAddressSpec::createVerifier);
+      prototype.registerHybridMethod("toBytes", &HybridAddressSpec::toBytes);
+    });
+  }
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,79 @@
+///
+/// HybridAddressSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+// Forward declaration of `HybridCancellationTokenSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridCancellationTokenSpec; }
+// Forward declaration of `HybridEncodedMessageSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridEncodedMessageSpec; }
+// Forward declaration of `HybridStreamingVerifierSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridStreamingVerifierSpec; }
+
+#include <NitroModules/Promise.hpp>
+#include <NitroModules/ArrayBuffer.hpp>
+#include <memory>
+#include "HybridCancellationTokenSpec.hpp"
+#include <optional>
+#include "HybridEncodedMessageSpec.hpp"
+#include "HybridStreamingVerifierSpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `Address`
+   * Inherit this class to create instances of `HybridAddressSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridAddress: public HybridAddressSpec {
+   * public:
+   *   HybridAddress(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridAddressSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridAddressSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridAddressSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual std::shared_ptr<Promise<bool>> verify(const std::shared_ptr<ArrayBuffer>& signature, const std::shared_ptr<ArrayBuffer>& message, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+      virtual std::shared_ptr<Promise<bool>> verifyFields(const std::shared_ptr<ArrayBuffer>& signature, const std::shared_ptr<ArrayBuffer>& fields, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+      virtual std::shared_ptr<Promise<bool>> verifyEncoded(const std::shared_ptr<ArrayBuffer>& signature, const std::shared_ptr<HybridEncodedMessageSpec>& message, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+      virtual std::shared_ptr<HybridStreamingVerifierSpec> createVerifier() = 0;
+      virtual std::shared_ptr<ArrayBuffer> toBytes() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "Address";
+  };
+
+} // namespace margelo::nitro::provable
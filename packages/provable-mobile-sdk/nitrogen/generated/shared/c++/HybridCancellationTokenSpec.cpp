@@ -0,0 +1,22 @@
+///
+/// HybridCancellationTokenSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridCancellationTokenSpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  void HybridCancellationTokenSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("isCancelled", &HybridCancellationTokenSpec::getIsCancelled);
+      prototype.registerHybridMethod("cancel", &HybridCancellationTokenSpec::cancel);
+    });
+  }
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,62 @@
+///
+/// HybridCancellationTokenSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::provable {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `CancellationToken`
+   * Inherit this class to create instances of `HybridCancellationTokenSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridCancellationToken: public HybridCancellationTokenSpec {
+   * public:
+   *   HybridCancellationToken(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridCancellationTokenSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridCancellationTokenSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridCancellationTokenSpec() override = default;
+
+    public:
+      // Properties
+      virtual bool getIsCancelled() = 0;
+
+    public:
+      // Methods
+      virtual void cancel() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "CancellationToken";
+  };
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,22 @@
+///
+/// HybridEncodedMessageSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridEncodedMessageSpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  void HybridEncodedMessageSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("fieldCount", &HybridEncodedMessageSpec::getFieldCount);
+      prototype.registerHybridMethod("toFields", &HybridEncodedMessageSpec::toFields);
+    });
+  }
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,63 @@
+///
+/// HybridEncodedMessageSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::provable {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `EncodedMessage`
+   * Inherit this class to create instances of `HybridEncodedMessageSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridEncodedMessage: public HybridEncodedMessageSpec {
+   * public:
+   *   HybridEncodedMessage(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridEncodedMessageSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridEncodedMessageSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridEncodedMessageSpec() override = default;
+
+    public:
+      // Properties
+      virtual double getFieldCount() = 0;
+
+    public:
+      // Methods
+      virtual std::shared_ptr<ArrayBuffer> toFields() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "EncodedMessage";
+  };
+
+} // namespace margelo::nitro::provable
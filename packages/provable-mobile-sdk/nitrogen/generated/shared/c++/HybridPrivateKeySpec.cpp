@@ -0,0 +1,28 @@
+///
+/// HybridPrivateKeySpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridPrivateKeySpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  void HybridPrivateKeySpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("toAddress", &HybridPrivateKeySpec::toAddress);
+      prototype.registerHybridMethod("toViewKey", &HybridPrivateKeySpec::toViewKey);
+      prototype.registerHybridMethod("sign", &HybridPrivateKeySpec::sign);
+      prototype.registerHybridMethod("signFields", &HybridPrivateKeySpec::signFields);
+      prototype.registerHybridMethod("signEncoded", &HybridPrivateKeySpec::signEncoded);
+      prototype.registerHybridMethod("signBatch", &HybridPrivateKeySpec::signBatch);
+      prototype.registerHybridMethod("createSigner", &HybridPrivateKeySpec::createSigner);
+      prototype.registerHybridMethod("toBytes", &HybridPrivateKeySpec::toBytes);
+    });
+  }
+
+} // namespace margelo::nitro::provable
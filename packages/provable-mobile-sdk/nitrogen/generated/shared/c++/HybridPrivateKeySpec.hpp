@@ -0,0 +1,89 @@
+///
+/// HybridPrivateKeySpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `HybridAddressSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridAddressSpec; }
+// Forward declaration of `HybridViewKeySpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridViewKeySpec; }
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+// Forward declaration of `HybridCancellationTokenSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridCancellationTokenSpec; }
+// Forward declaration of `HybridEncodedMessageSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridEncodedMessageSpec; }
+// Forward declaration of `HybridStreamingSignerSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridStreamingSignerSpec; }
+
+#include <memory>
+#include "HybridAddressSpec.hpp"
+#include <NitroModules/Promise.hpp>
+#include "HybridViewKeySpec.hpp"
+#include <NitroModules/ArrayBuffer.hpp>
+#include "HybridCancellationTokenSpec.hpp"
+#include <optional>
+#include "HybridEncodedMessageSpec.hpp"
+#include <vector>
+#include "HybridStreamingSignerSpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `PrivateKey`
+   * Inherit this class to create instances of `HybridPrivateKeySpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridPrivateKey: public HybridPrivateKeySpec {
+   * public:
+   *   HybridPrivateKey(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridPrivateKeySpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridPrivateKeySpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridPrivateKeySpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual std::shared_ptr<Promise<std::shared_ptr<HybridAddressSpec>>> toAddress() = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<HybridViewKeySpec>>> toViewKey() = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> sign(const std::shared_ptr<ArrayBuffer>& message, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> signFields(const std::shared_ptr<ArrayBuffer>& fields, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> signEncoded(const std::shared_ptr<HybridEncodedMessageSpec>& message, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> signBatch(const std::vector<std::shared_ptr<ArrayBuffer>>& messages, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+      virtual std::shared_ptr<HybridStreamingSignerSpec> createSigner() = 0;
+      virtual std::shared_ptr<ArrayBuffer> toBytes() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "PrivateKey";
+  };
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,22 @@
+///
+/// HybridStreamingSignerSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridStreamingSignerSpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  void HybridStreamingSignerSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("update", &HybridStreamingSignerSpec::update);
+      prototype.registerHybridMethod("finalize", &HybridStreamingSignerSpec::finalize);
+    });
+  }
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,22 @@
+///
+/// HybridStreamingVerifierSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridStreamingVerifierSpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  void HybridStreamingVerifierSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("update", &HybridStreamingVerifierSpec::update);
+      prototype.registerHybridMethod("finalize", &HybridStreamingVerifierSpec::finalize);
+    });
+  }
+
+} // namespace margelo::nitro::provable
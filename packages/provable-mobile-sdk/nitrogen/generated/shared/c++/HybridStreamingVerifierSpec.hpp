@@ -0,0 +1,65 @@
+///
+/// HybridStreamingVerifierSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+
+#include <NitroModules/Promise.hpp>
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::provable {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `StreamingVerifier`
+   * Inherit this class to create instances of `HybridStreamingVerifierSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridStreamingVerifier: public HybridStreamingVerifierSpec {
+   * public:
+   *   HybridStreamingVerifier(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridStreamingVerifierSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridStreamingVerifierSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridStreamingVerifierSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual std::shared_ptr<Promise<void>> update(const std::shared_ptr<ArrayBuffer>& chunk) = 0;
+      virtual std::shared_ptr<Promise<bool>> finalize(const std::shared_ptr<ArrayBuffer>& signature) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "StreamingVerifier";
+  };
+
+} // namespace margelo::nitro::provable
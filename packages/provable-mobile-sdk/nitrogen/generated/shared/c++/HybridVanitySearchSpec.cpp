@@ -0,0 +1,24 @@
+///
+/// HybridVanitySearchSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridVanitySearchSpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  void HybridVanitySearchSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("attempts", &HybridVanitySearchSpec::getAttempts);
+      prototype.registerHybridGetter("attemptsPerSecond", &HybridVanitySearchSpec::getAttemptsPerSecond);
+      prototype.registerHybridMethod("result", &HybridVanitySearchSpec::result);
+      prototype.registerHybridMethod("cancel", &HybridVanitySearchSpec::cancel);
+    });
+  }
+
+} // namespace margelo::nitro::provable
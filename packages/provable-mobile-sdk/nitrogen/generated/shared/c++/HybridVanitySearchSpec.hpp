@@ -0,0 +1,67 @@
+///
+/// HybridVanitySearchSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `HybridPrivateKeySpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridPrivateKeySpec; }
+
+#include <NitroModules/Promise.hpp>
+#include <memory>
+#include "HybridPrivateKeySpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `VanitySearch`
+   * Inherit this class to create instances of `HybridVanitySearchSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridVanitySearch: public HybridVanitySearchSpec {
+   * public:
+   *   HybridVanitySearch(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridVanitySearchSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridVanitySearchSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridVanitySearchSpec() override = default;
+
+    public:
+      // Properties
+      virtual double getAttempts() = 0;
+      virtual double getAttemptsPerSecond() = 0;
+
+    public:
+      // Methods
+      virtual std::shared_ptr<Promise<std::shared_ptr<HybridPrivateKeySpec>>> result() = 0;
+      virtual void cancel() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "VanitySearch";
+  };
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,23 @@
+///
+/// HybridViewKeySpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridViewKeySpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  void HybridViewKeySpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("toAddress", &HybridViewKeySpec::toAddress);
+      prototype.registerHybridMethod("toBytes", &HybridViewKeySpec::toBytes);
+      prototype.registerHybridMethod("scanRecords", &HybridViewKeySpec::scanRecords);
+    });
+  }
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,74 @@
+///
+/// HybridViewKeySpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `HybridAddressSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridAddressSpec; }
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+// Forward declaration of `HybridCancellationTokenSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridCancellationTokenSpec; }
+
+#include <memory>
+#include "HybridAddressSpec.hpp"
+#include <NitroModules/Promise.hpp>
+#include <NitroModules/ArrayBuffer.hpp>
+#include "HybridCancellationTokenSpec.hpp"
+#include <optional>
+
+namespace margelo::nitro::provable {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `ViewKey`
+   * Inherit this class to create instances of `HybridViewKeySpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridViewKey: public HybridViewKeySpec {
+   * public:
+   *   HybridViewKey(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridViewKeySpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridViewKeySpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridViewKeySpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual std::shared_ptr<Promise<std::shared_ptr<HybridAddressSpec>>> toAddress() = 0;
+      virtual std::shared_ptr<ArrayBuffer> toBytes() = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> scanRecords(const std::shared_ptr<ArrayBuffer>& records, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "ViewKey";
+  };
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,77 @@
+///
+/// NoncePoolStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+namespace margelo::nitro::provable {
+
+  /**
+   * A struct which can be represented as a JavaScript object (NoncePoolStats).
+   */
+  struct NoncePoolStats {
+  public:
+    double available     SWIFT_PRIVATE;
+    double depth     SWIFT_PRIVATE;
+    double pooledSignatures     SWIFT_PRIVATE;
+    double inlineSignatures     SWIFT_PRIVATE;
+
+  public:
+    NoncePoolStats() = default;
+    explicit NoncePoolStats(double available, double depth, double pooledSignatures, double inlineSignatures): available(available), depth(depth), pooledSignatures(pooledSignatures), inlineSignatures(inlineSignatures) {}
+  };
+
+} // namespace margelo::nitro::provable
+
+namespace margelo::nitro {
+
+  // C++ NoncePoolStats <> JS NoncePoolStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::provable::NoncePoolStats> final {
+    static inline margelo::nitro::provable::NoncePoolStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::provable::NoncePoolStats(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "available")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "depth")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "pooledSignatures")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "inlineSignatures"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::NoncePoolStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "available", JSIConverter<double>::toJSI(runtime, arg.available));
+      obj.setProperty(runtime, "depth", JSIConverter<double>::toJSI(runtime, arg.depth));
+      obj.setProperty(runtime, "pooledSignatures", JSIConverter<double>::toJSI(runtime, arg.pooledSignatures));
+      obj.setProperty(runtime, "inlineSignatures", JSIConverter<double>::toJSI(runtime, arg.inlineSignatures));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "available"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "depth"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "pooledSignatures"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "inlineSignatures"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
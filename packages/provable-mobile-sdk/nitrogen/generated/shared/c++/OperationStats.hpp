@@ -0,0 +1,89 @@
+///
+/// OperationStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+namespace margelo::nitro::provable {
+
+  /**
+   * A struct which can be represented as a JavaScript object (OperationStats).
+   */
+  struct OperationStats {
+  public:
+    double count     SWIFT_PRIVATE;
+    double totalMicros     SWIFT_PRIVATE;
+    double meanMicros     SWIFT_PRIVATE;
+    double p50Micros     SWIFT_PRIVATE;
+    double p90Micros     SWIFT_PRIVATE;
+    double p99Micros     SWIFT_PRIVATE;
+    double maxMicros     SWIFT_PRIVATE;
+
+  public:
+    OperationStats() = default;
+    explicit OperationStats(double count, double totalMicros, double meanMicros, double p50Micros, double p90Micros, double p99Micros, double maxMicros): count(count), totalMicros(totalMicros), meanMicros(meanMicros), p50Micros(p50Micros), p90Micros(p90Micros), p99Micros(p99Micros), maxMicros(maxMicros) {}
+  };
+
+} // namespace margelo::nitro::provable
+
+namespace margelo::nitro {
+
+  // C++ OperationStats <> JS OperationStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::provable::OperationStats> final {
+    static inline margelo::nitro::provable::OperationStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::provable::OperationStats(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "count")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "totalMicros")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "meanMicros")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "p50Micros")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "p90Micros")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "p99Micros")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "maxMicros"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::OperationStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "count", JSIConverter<double>::toJSI(runtime, arg.count));
+      obj.setProperty(runtime, "totalMicros", JSIConverter<double>::toJSI(runtime, arg.totalMicros));
+      obj.setProperty(runtime, "meanMicros", JSIConverter<double>::toJSI(runtime, arg.meanMicros));
+      obj.setProperty(runtime, "p50Micros", JSIConverter<double>::toJSI(runtime, arg.p50Micros));
+      obj.setProperty(runtime, "p90Micros", JSIConverter<double>::toJSI(runtime, arg.p90Micros));
+      obj.setProperty(runtime, "p99Micros", JSIConverter<double>::toJSI(runtime, arg.p99Micros));
+      obj.setProperty(runtime, "maxMicros", JSIConverter<double>::toJSI(runtime, arg.maxMicros));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "count"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "totalMicros"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "meanMicros"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "p50Micros"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "p90Micros"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "p99Micros"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "maxMicros"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -1,89 +0,0 @@
-///
-/// PrivateKey.hpp
-/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
-/// https://github.com/mrousavy/nitro
-/// Copyright © 2025 Marc Rousavy @ Margelo
-///
-
-#pragma once
-
-#if __has_include(<NitroModules/JSIConverter.hpp>)
-#include <NitroModules/JSIConverter.hpp>
-#else
-#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
-#endif
-#if __has_include(<NitroModules/NitroDefines.hpp>)
-#include <NitroModules/NitroDefines.hpp>
-#else
-#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
-#endif
-
-// Forward declaration of `Address` to properly resolve imports.
-namespace margelo::nitro::provable { struct Address; }
-// Forward declaration of `ViewKey` to properly resolve imports.
-namespace margelo::nitro::provable { struct ViewKey; }
-// Forward declaration of `ArrayBuffer` to properly resolve imports.
-namespace NitroModules { class ArrayBuffer; }
-
-#include <string>
-#include <NitroModules/Promise.hpp>
-#include <functional>
-#include "Address.hpp"
-#include "ViewKey.hpp"
-#include <NitroModules/ArrayBuffer.hpp>
-
-namespace margelo::nitro::provable {
-
-  /**
-   * A struct which can be represented as a JavaScript object (PrivateKey).
-   */
-  struct PrivateKey {
-  public:
-    std::function<std::shared_ptr<Promise<std::string>>()> toString     SWIFT_PRIVATE;
-    std::function<std::shared_ptr<Promise<Address>>()> toAddress     SWIFT_PRIVATE;
-    std::function<std::shared_ptr<Promise<ViewKey>>()> toViewKey     SWIFT_PRIVATE;
-    std::function<std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>(const std::shared_ptr<ArrayBuffer>& /* message */)> sign     SWIFT_PRIVATE;
-
-  public:
-    PrivateKey() = default;
-    explicit PrivateKey(std::function<std::shared_ptr<Promise<std::string>>()> toString, std::function<std::shared_ptr<Promise<Address>>()> toAddress, std::function<std::shared_ptr<Promise<ViewKey>>()> toViewKey, std::function<std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>(const std::shared_ptr<ArrayBuffer>& /* message */)> sign): toString(toString), toAddress(toAddress), toViewKey(toViewKey), sign(sign) {}
-  };
-
-} // namespace margelo::nitro::provable
-
-namespace margelo::nitro {
-
-  // C++ PrivateKey <> JS PrivateKey (object)
-  template <>
-  struct JSIConverter<margelo::nitro::provable::PrivateKey> final {
-    static inline margelo::nitro::provable::PrivateKey fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
-      jsi::Object obj = arg.asObject(runtime);
-      return margelo::nitro::provable::PrivateKey(
-        JSIConverter<std::function<std::shared_ptr<Promise<std::string>>()>>::fromJSI(runtime, obj.getProperty(runtime, "toString")),
-        JSIConverter<std::function<std::shared_ptr<Promise<margelo::nitro::provable::Address>>()>>::fromJSI(runtime, obj.getProperty(runtime, "toAddress")),
-        JSIConverter<std::function<std::shared_ptr<Promise<margelo::nitro::provable::ViewKey>>()>>::fromJSI(runtime, obj.getProperty(runtime, "toViewKey")),
-        JSIConverter<std::function<std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>(const std::shared_ptr<ArrayBuffer>&)>>::fromJSI(runtime, obj.getProperty(runtime, "sign"))
-      );
-    }
-    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::PrivateKey& arg) {
-      jsi::Object obj(runtime);
-      obj.setProperty(runtime, "toString", JSIConverter<std::function<std::shared_ptr<Promise<std::string>>()>>::toJSI(runtime, arg.toString));
-      obj.setProperty(runtime, "toAddress", JSIConverter<std::function<std::shared_ptr<Promise<margelo::nitro::provable::Address>>()>>::toJSI(runtime, arg.toAddress));
-      obj.setProperty(runtime, "toViewKey", JSIConverter<std::function<std::shared_ptr<Promise<margelo::nitro::provable::ViewKey>>()>>::toJSI(runtime, arg.toViewKey));
-      obj.setProperty(runtime, "sign", JSIConverter<std::function<std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>(const std::shared_ptr<ArrayBuffer>&)>>::toJSI(runtime, arg.sign));
-      return obj;
-    }
-    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
-      if (!value.isObject()) {
-        return false;
-      }
-      jsi::Object obj = value.getObject(runtime);
-      if (!JSIConverter<std::function<std::shared_ptr<Promise<std::string>>()>>::canConvert(runtime, obj.getProperty(runtime, "toString"))) return false;
-      if (!JSIConverter<std::function<std::shared_ptr<Promise<margelo::nitro::provable::Address>>()>>::canConvert(runtime, obj.getProperty(runtime, "toAddress"))) return false;
-      if (!JSIConverter<std::function<std::shared_ptr<Promise<margelo::nitro::provable::ViewKey>>()>>::canConvert(runtime, obj.getProperty(runtime, "toViewKey"))) return false;
-      if (!JSIConverter<std::function<std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>(const std::shared_ptr<ArrayBuffer>&)>>::canConvert(runtime, obj.getProperty(runtime, "sign"))) return false;
-      return true;
-    }
-  };
-
-} // namespace margelo::nitro
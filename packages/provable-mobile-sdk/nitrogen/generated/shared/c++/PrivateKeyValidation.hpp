@@ -0,0 +1,77 @@
+///
+/// PrivateKeyValidation.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+// Forward declaration of `HybridPrivateKeySpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridPrivateKeySpec; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+#include <memory>
+#include "HybridPrivateKeySpec.hpp"
+#include <vector>
+
+namespace margelo::nitro::provable {
+
+  /**
+   * A struct which can be represented as a JavaScript object (PrivateKeyValidation).
+   */
+  struct PrivateKeyValidation {
+  public:
+    std::shared_ptr<ArrayBuffer> valid     SWIFT_PRIVATE;
+    std::vector<std::shared_ptr<HybridPrivateKeySpec>> privateKeys     SWIFT_PRIVATE;
+
+  public:
+    PrivateKeyValidation() = default;
+    explicit PrivateKeyValidation(std::shared_ptr<ArrayBuffer> valid, std::vector<std::shared_ptr<HybridPrivateKeySpec>> privateKeys): valid(valid), privateKeys(privateKeys) {}
+  };
+
+} // namespace margelo::nitro::provable
+
+namespace margelo::nitro {
+
+  // C++ PrivateKeyValidation <> JS PrivateKeyValidation (object)
+  template <>
+  struct JSIConverter<margelo::nitro::provable::PrivateKeyValidation> final {
+    static inline margelo::nitro::provable::PrivateKeyValidation fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::provable::PrivateKeyValidation(
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "valid")),
+        JSIConverter<std::vector<std::shared_ptr<margelo::nitro::provable::HybridPrivateKeySpec>>>::fromJSI(runtime, obj.getProperty(runtime, "privateKeys"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::PrivateKeyValidation& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "valid", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.valid));
+      obj.setProperty(runtime, "privateKeys", JSIConverter<std::vector<std::shared_ptr<margelo::nitro::provable::HybridPrivateKeySpec>>>::toJSI(runtime, arg.privateKeys));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "valid"))) return false;
+      if (!JSIConverter<std::vector<std::shared_ptr<margelo::nitro::provable::HybridPrivateKeySpec>>>::canConvert(runtime, obj.getProperty(runtime, "privateKeys"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,69 @@
+///
+/// RegistryStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+namespace margelo::nitro::provable {
+
+  /**
+   * A struct which can be represented as a JavaScript object (RegistryStats).
+   */
+  struct RegistryStats {
+  public:
+    double liveHandles     SWIFT_PRIVATE;
+    double lockWaitMicros     SWIFT_PRIVATE;
+
+  public:
+    RegistryStats() = default;
+    explicit RegistryStats(double liveHandles, double lockWaitMicros): liveHandles(liveHandles), lockWaitMicros(lockWaitMicros) {}
+  };
+
+} // namespace margelo::nitro::provable
+
+namespace margelo::nitro {
+
+  // C++ RegistryStats <> JS RegistryStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::provable::RegistryStats> final {
+    static inline margelo::nitro::provable::RegistryStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::provable::RegistryStats(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "liveHandles")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "lockWaitMicros"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::RegistryStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "liveHandles", JSIConverter<double>::toJSI(runtime, arg.liveHandles));
+      obj.setProperty(runtime, "lockWaitMicros", JSIConverter<double>::toJSI(runtime, arg.lockWaitMicros));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "liveHandles"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "lockWaitMicros"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,83 @@
+///
+/// RestoredAccount.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `HybridPrivateKeySpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridPrivateKeySpec; }
+// Forward declaration of `HybridViewKeySpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridViewKeySpec; }
+// Forward declaration of `HybridAddressSpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridAddressSpec; }
+
+#include <memory>
+#include "HybridPrivateKeySpec.hpp"
+#include "HybridViewKeySpec.hpp"
+#include "HybridAddressSpec.hpp"
+
+namespace margelo::nitro::provable {
+
+  /**
+   * A struct which can be represented as a JavaScript object (RestoredAccount).
+   */
+  struct RestoredAccount {
+  public:
+    std::shared_ptr<HybridPrivateKeySpec> privateKey     SWIFT_PRIVATE;
+    std::shared_ptr<HybridViewKeySpec> viewKey     SWIFT_PRIVATE;
+    std::shared_ptr<HybridAddressSpec> address     SWIFT_PRIVATE;
+
+  public:
+    RestoredAccount() = default;
+    explicit RestoredAccount(std::shared_ptr<HybridPrivateKeySpec> privateKey, std::shared_ptr<HybridViewKeySpec> viewKey, std::shared_ptr<HybridAddressSpec> address): privateKey(privateKey), viewKey(viewKey), address(address) {}
+  };
+
+} // namespace margelo::nitro::provable
+
+namespace margelo::nitro {
+
+  // C++ RestoredAccount <> JS RestoredAccount (object)
+  template <>
+  struct JSIConverter<margelo::nitro::provable::RestoredAccount> final {
+    static inline margelo::nitro::provable::RestoredAccount fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::provable::RestoredAccount(
+        JSIConverter<std::shared_ptr<margelo::nitro::provable::HybridPrivateKeySpec>>::fromJSI(runtime, obj.getProperty(runtime, "privateKey")),
+        JSIConverter<std::shared_ptr<margelo::nitro::provable::HybridViewKeySpec>>::fromJSI(runtime, obj.getProperty(runtime, "viewKey")),
+        JSIConverter<std::shared_ptr<margelo::nitro::provable::HybridAddressSpec>>::fromJSI(runtime, obj.getProperty(runtime, "address"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::RestoredAccount& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "privateKey", JSIConverter<std::shared_ptr<margelo::nitro::provable::HybridPrivateKeySpec>>::toJSI(runtime, arg.privateKey));
+      obj.setProperty(runtime, "viewKey", JSIConverter<std::shared_ptr<margelo::nitro::provable::HybridViewKeySpec>>::toJSI(runtime, arg.viewKey));
+      obj.setProperty(runtime, "address", JSIConverter<std::shared_ptr<margelo::nitro::provable::HybridAddressSpec>>::toJSI(runtime, arg.address));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<std::shared_ptr<margelo::nitro::provable::HybridPrivateKeySpec>>::canConvert(runtime, obj.getProperty(runtime, "privateKey"))) return false;
+      if (!JSIConverter<std::shared_ptr<margelo::nitro::provable::HybridViewKeySpec>>::canConvert(runtime, obj.getProperty(runtime, "viewKey"))) return false;
+      if (!JSIConverter<std::shared_ptr<margelo::nitro::provable::HybridAddressSpec>>::canConvert(runtime, obj.getProperty(runtime, "address"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,77 @@
+///
+/// RestoredAccounts.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `RestoredAccount` to properly resolve imports.
+namespace margelo::nitro::provable { struct RestoredAccount; }
+
+#include "RestoredAccount.hpp"
+#include <vector>
+
+namespace margelo::nitro::provable {
+
+  /**
+   * A struct which can be represented as a JavaScript object (RestoredAccounts).
+   */
+  struct RestoredAccounts {
+  public:
+    std::vector<RestoredAccount> accounts     SWIFT_PRIVATE;
+    double cached     SWIFT_PRIVATE;
+    double derived     SWIFT_PRIVATE;
+
+  public:
+    RestoredAccounts() = default;
+    explicit RestoredAccounts(std::vector<RestoredAccount> accounts, double cached, double derived): accounts(accounts), cached(cached), derived(derived) {}
+  };
+
+} // namespace margelo::nitro::provable
+
+namespace margelo::nitro {
+
+  // C++ RestoredAccounts <> JS RestoredAccounts (object)
+  template <>
+  struct JSIConverter<margelo::nitro::provable::RestoredAccounts> final {
+    static inline margelo::nitro::provable::RestoredAccounts fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::provable::RestoredAccounts(
+        JSIConverter<std::vector<margelo::nitro::provable::RestoredAccount>>::fromJSI(runtime, obj.getProperty(runtime, "accounts")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "cached")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "derived"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::RestoredAccounts& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "accounts", JSIConverter<std::vector<margelo::nitro::provable::RestoredAccount>>::toJSI(runtime, arg.accounts));
+      obj.setProperty(runtime, "cached", JSIConverter<double>::toJSI(runtime, arg.cached));
+      obj.setProperty(runtime, "derived", JSIConverter<double>::toJSI(runtime, arg.derived));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<std::vector<margelo::nitro::provable::RestoredAccount>>::canConvert(runtime, obj.getProperty(runtime, "accounts"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "cached"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "derived"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,119 @@
+///
+/// SdkStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `OperationStats` to properly resolve imports.
+namespace margelo::nitro::provable { struct OperationStats; }
+// Forward declaration of `RegistryStats` to properly resolve imports.
+namespace margelo::nitro::provable { struct RegistryStats; }
+
+#include "OperationStats.hpp"
+#include "RegistryStats.hpp"
+
+namespace margelo::nitro::provable {
+
+  /**
+   * A struct which can be represented as a JavaScript object (SdkStats).
+   */
+  struct SdkStats {
+  public:
+    bool enabled     SWIFT_PRIVATE;
+    OperationStats parse     SWIFT_PRIVATE;
+    OperationStats derive     SWIFT_PRIVATE;
+    OperationStats sign     SWIFT_PRIVATE;
+    OperationStats verify     SWIFT_PRIVATE;
+    OperationStats batch     SWIFT_PRIVATE;
+    OperationStats marshal     SWIFT_PRIVATE;
+    RegistryStats privateKeys     SWIFT_PRIVATE;
+    RegistryStats addresses     SWIFT_PRIVATE;
+    RegistryStats viewKeys     SWIFT_PRIVATE;
+    RegistryStats streams     SWIFT_PRIVATE;
+    RegistryStats vanitySearches     SWIFT_PRIVATE;
+    double bytesCopied     SWIFT_PRIVATE;
+
+  public:
+    SdkStats() = default;
+    explicit SdkStats(bool enabled, OperationStats parse, OperationStats derive, OperationStats sign, OperationStats verify, OperationStats batch, OperationStats marshal, RegistryStats privateKeys, RegistryStats addresses, RegistryStats viewKeys, RegistryStats streams, RegistryStats vanitySearches, double bytesCopied): enabled(enabled), parse(parse), derive(derive), sign(sign), verify(verify), batch(batch), marshal(marshal), privateKeys(privateKeys), addresses(addresses), viewKeys(viewKeys), streams(streams), vanitySearches(vanitySearches), bytesCopied(bytesCopied) {}
+  };
+
+} // namespace margelo::nitro::provable
+
+namespace margelo::nitro {
+
+  // C++ SdkStats <> JS SdkStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::provable::SdkStats> final {
+    static inline margelo::nitro::provable::SdkStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::provable::SdkStats(
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, "enabled")),
+        JSIConverter<margelo::nitro::provable::OperationStats>::fromJSI(runtime, obj.getProperty(runtime, "parse")),
+        JSIConverter<margelo::nitro::provable::OperationStats>::fromJSI(runtime, obj.getProperty(runtime, "derive")),
+        JSIConverter<margelo::nitro::provable::OperationStats>::fromJSI(runtime, obj.getProperty(runtime, "sign")),
+        JSIConverter<margelo::nitro::provable::OperationStats>::fromJSI(runtime, obj.getProperty(runtime, "verify")),
+        JSIConverter<margelo::nitro::provable::OperationStats>::fromJSI(runtime, obj.getProperty(runtime, "batch")),
+        JSIConverter<margelo::nitro::provable::OperationStats>::fromJSI(runtime, obj.getProperty(runtime, "marshal")),
+        JSIConverter<margelo::nitro::provable::RegistryStats>::fromJSI(runtime, obj.getProperty(runtime, "privateKeys")),
+        JSIConverter<margelo::nitro::provable::RegistryStats>::fromJSI(runtime, obj.getProperty(runtime, "addresses")),
+        JSIConverter<margelo::nitro::provable::RegistryStats>::fromJSI(runtime, obj.getProperty(runtime, "viewKeys")),
+        JSIConverter<margelo::nitro::provable::RegistryStats>::fromJSI(runtime, obj.getProperty(runtime, "streams")),
+        JSIConverter<margelo::nitro::provable::RegistryStats>::fromJSI(runtime, obj.getProperty(runtime, "vanitySearches")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "bytesCopied"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::SdkStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "enabled", JSIConverter<bool>::toJSI(runtime, arg.enabled));
+      obj.setProperty(runtime, "parse", JSIConverter<margelo::nitro::provable::OperationStats>::toJSI(runtime, arg.parse));
+      obj.setProperty(runtime, "derive", JSIConverter<margelo::nitro::provable::OperationStats>::toJSI(runtime, arg.derive));
+      obj.setProperty(runtime, "sign", JSIConverter<margelo::nitro::provable::OperationStats>::toJSI(runtime, arg.sign));
+      obj.setProperty(runtime, "verify", JSIConverter<margelo::nitro::provable::OperationStats>::toJSI(runtime, arg.verify));
+      obj.setProperty(runtime, "batch", JSIConverter<margelo::nitro::provable::OperationStats>::toJSI(runtime, arg.batch));
+      obj.setProperty(runtime, "marshal", JSIConverter<margelo::nitro::provable::OperationStats>::toJSI(runtime, arg.marshal));
+      obj.setProperty(runtime, "privateKeys", JSIConverter<margelo::nitro::provable::RegistryStats>::toJSI(runtime, arg.privateKeys));
+      obj.setProperty(runtime, "addresses", JSIConverter<margelo::nitro::provable::RegistryStats>::toJSI(runtime, arg.addresses));
+      obj.setProperty(runtime, "viewKeys", JSIConverter<margelo::nitro::provable::RegistryStats>::toJSI(runtime, arg.viewKeys));
+      obj.setProperty(runtime, "streams", JSIConverter<margelo::nitro::provable::RegistryStats>::toJSI(runtime, arg.streams));
+      obj.setProperty(runtime, "vanitySearches", JSIConverter<margelo::nitro::provable::RegistryStats>::toJSI(runtime, arg.vanitySearches));
+      obj.setProperty(runtime, "bytesCopied", JSIConverter<double>::toJSI(runtime, arg.bytesCopied));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, "enabled"))) return false;
+      if (!JSIConverter<margelo::nitro::provable::OperationStats>::canConvert(runtime, obj.getProperty(runtime, "parse"))) return false;
+      if (!JSIConverter<margelo::nitro::provable::OperationStats>::canConvert(runtime, obj.getProperty(runtime, "derive"))) return false;
+      if (!JSIConverter<margelo::nitro::provable::OperationStats>::canConvert(runtime, obj.getProperty(runtime, "sign"))) return false;
+      if (!JSIConverter<margelo::nitro::provable::OperationStats>::canConvert(runtime, obj.getProperty(runtime, "verify"))) return false;
+      if (!JSIConverter<margelo::nitro::provable::OperationStats>::canConvert(runtime, obj.getProperty(runtime, "batch"))) return false;
+      if (!JSIConverter<margelo::nitro::provable::OperationStats>::canConvert(runtime, obj.getProperty(runtime, "marshal"))) return false;
+      if (!JSIConverter<margelo::nitro::provable::RegistryStats>::canConvert(runtime, obj.getProperty(runtime, "privateKeys"))) return false;
+      if (!JSIConverter<margelo::nitro::provable::RegistryStats>::canConvert(runtime, obj.getProperty(runtime, "addresses"))) return false;
+      if (!JSIConverter<margelo::nitro::provable::RegistryStats>::canConvert(runtime, obj.getProperty(runtime, "viewKeys"))) return false;
+      if (!JSIConverter<margelo::nitro::provable::RegistryStats>::canConvert(runtime, obj.getProperty(runtime, "streams"))) return false;
+      if (!JSIConverter<margelo::nitro::provable::RegistryStats>::canConvert(runtime, obj.getProperty(runtime, "vanitySearches"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "bytesCopied"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
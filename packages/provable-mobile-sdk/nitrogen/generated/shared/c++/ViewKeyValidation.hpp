@@ -0,0 +1,77 @@
+///
+/// ViewKeyValidation.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ArrayBuffer` to properly resolve imports.
+namespace NitroModules { class ArrayBuffer; }
+// Forward declaration of `HybridViewKeySpec` to properly resolve imports.
+namespace margelo::nitro::provable { class HybridViewKeySpec; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+#include <memory>
+#include "HybridViewKeySpec.hpp"
+#include <vector>
+
+namespace margelo::nitro::provable {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ViewKeyValidation).
+   */
+  struct ViewKeyValidation {
+  public:
+    std::shared_ptr<ArrayBuffer> valid     SWIFT_PRIVATE;
+    std::vector<std::shared_ptr<HybridViewKeySpec>> viewKeys     SWIFT_PRIVATE;
+
+  public:
+    ViewKeyValidation() = default;
+    explicit ViewKeyValidation(std::shared_ptr<ArrayBuffer> valid, std::vector<std::shared_ptr<HybridViewKeySpec>> viewKeys): valid(valid), viewKeys(viewKeys) {}
+  };
+
+} // namespace margelo::nitro::provable
+
+namespace margelo::nitro {
+
+  // C++ ViewKeyValidation <> JS ViewKeyValidation (object)
+  template <>
+  struct JSIConverter<margelo::nitro::provable::ViewKeyValidation> final {
+    static inline margelo::nitro::provable::ViewKeyValidation fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::provable::ViewKeyValidation(
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, "valid")),
+        JSIConverter<std::vector<std::shared_ptr<margelo::nitro::provable::HybridViewKeySpec>>>::fromJSI(runtime, obj.getProperty(runtime, "viewKeys"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::ViewKeyValidation& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "valid", JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.valid));
+      obj.setProperty(runtime, "viewKeys", JSIConverter<std::vector<std::shared_ptr<margelo::nitro::provable::HybridViewKeySpec>>>::toJSI(runtime, arg.viewKeys));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, "valid"))) return false;
+      if (!JSIConverter<std::vector<std::shared_ptr<margelo::nitro::provable::HybridViewKeySpec>>>::canConvert(runtime, obj.getProperty(runtime, "viewKeys"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,81 @@
+///
+/// WarmUpStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+namespace margelo::nitro::provable {
+
+  /**
+   * A struct which can be represented as a JavaScript object (WarmUpStats).
+   */
+  struct WarmUpStats {
+  public:
+    double registriesMillis     SWIFT_PRIVATE;
+    double networkMillis     SWIFT_PRIVATE;
+    double signingContextMillis     SWIFT_PRIVATE;
+    double threadPoolMillis     SWIFT_PRIVATE;
+    double totalMillis     SWIFT_PRIVATE;
+
+  public:
+    WarmUpStats() = default;
+    explicit WarmUpStats(double registriesMillis, double networkMillis, double signingContextMillis, double threadPoolMillis, double totalMillis): registriesMillis(registriesMillis), networkMillis(networkMillis), signingContextMillis(signingContextMillis), threadPoolMillis(threadPoolMillis), totalMillis(totalMillis) {}
+  };
+
+} // namespace margelo::nitro::provable
+
+namespace margelo::nitro {
+
+  // C++ WarmUpStats <> JS WarmUpStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::provable::WarmUpStats> final {
+    static inline margelo::nitro::provable::WarmUpStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::provable::WarmUpStats(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "registriesMillis")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "networkMillis")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "signingContextMillis")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "threadPoolMillis")),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, "totalMillis"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::provable::WarmUpStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "registriesMillis", JSIConverter<double>::toJSI(runtime, arg.registriesMillis));
+      obj.setProperty(runtime, "networkMillis", JSIConverter<double>::toJSI(runtime, arg.networkMillis));
+      obj.setProperty(runtime, "signingContextMillis", JSIConverter<double>::toJSI(runtime, arg.signingContextMillis));
+      obj.setProperty(runtime, "threadPoolMillis", JSIConverter<double>::toJSI(runtime, arg.threadPoolMillis));
+      obj.setProperty(runtime, "totalMillis", JSIConverter<double>::toJSI(runtime, arg.totalMillis));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "registriesMillis"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "networkMillis"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "signingContextMillis"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "threadPoolMillis"))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, "totalMillis"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "rust/lib.rs.h"
+#include <NitroModules/ArrayBuffer.hpp>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace margelo::nitro::provable {
+
+// Times a copy between JS buffers and the bridge for `Account.getStats()` - costs one call into Rust when stats are disabled
+class MarshalTimer {
+ public:
+  explicit MarshalTimer(size_t bytes) : _bytes(bytes), _enabled(stats_enabled()) {
+    if (_enabled) {
+      _started = std::chrono::steady_clock::now();
+    }
+  }
+
+  ~MarshalTimer() {
+    if (_enabled) {
+      auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _started);
+      record_marshal(static_cast<uint64_t>(elapsed.count()), _bytes);
+    }
+  }
+
+  MarshalTimer(const MarshalTimer&) = delete;
+  MarshalTimer& operator=(const MarshalTimer&) = delete;
+
+ private:
+  uint64_t _bytes;
+  bool _enabled;
+  std::chrono::steady_clock::time_point _started;
+};
+
+// Native-owned buffers may be read from any thread, JS-owned ones have to be copied before going async
+inline std::shared_ptr<ArrayBuffer> retainForAsync(const std::shared_ptr<ArrayBuffer>& buffer) {
+  if (buffer->isOwner()) {
+    return buffer;
+  }
+  MarshalTimer timer(buffer->size());
+  return ArrayBuffer::copy(buffer->data(), buffer->size());
+}
+
+inline std::shared_ptr<ArrayBuffer> toArrayBuffer(const rust::Vec<uint8_t>& bytes) {
+  MarshalTimer timer(bytes.size());
+  auto buffer = ArrayBuffer::allocate(bytes.size());
+  std::memcpy(buffer->data(), bytes.data(), bytes.size());
+  return buffer;
+}
+
+// Allocates a buffer of `size` bytes and fills it with `write`, which returns the usual Rust result
+template <typename Write>
+inline std::shared_ptr<ArrayBuffer> writeToArrayBuffer(size_t size, Write&& write) {
+  auto buffer = ArrayBuffer::allocate(size);
+  auto result = write(rust::Slice<uint8_t>(buffer->data(), buffer->size()));
+  if (!result.success) {
+    throw std::runtime_error(std::string(result.error));
+  }
+  return buffer;
+}
+
+inline rust::Slice<const uint8_t> asSlice(const std::shared_ptr<ArrayBuffer>& buffer) {
+  return rust::Slice<const uint8_t>(buffer->data(), buffer->size());
+}
+
+inline rust::Slice<uint8_t> asMutableSlice(const std::shared_ptr<ArrayBuffer>& buffer) {
+  return rust::Slice<uint8_t>(buffer->data(), buffer->size());
+}
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,126 @@
+#include "CryptoExecutor.hpp"
+#include <algorithm>
+
+namespace margelo::nitro::provable {
+
+CryptoExecutor& CryptoExecutor::shared() {
+  // Intentionally leaked so workers never race static destruction at exit
+  static auto* executor = new CryptoExecutor(std::max(2u, std::thread::hardware_concurrency()));
+  return *executor;
+}
+
+CryptoExecutor::CryptoExecutor(size_t workerCount) {
+  for (size_t i = 0; i < workerCount; ++i) {
+    _queues.push_back(std::make_unique<Queue>());
+  }
+  for (size_t i = 0; i < workerCount; ++i) {
+    _workers.emplace_back([this, i] { workerLoop(i); });
+  }
+}
+
+CryptoExecutor::~CryptoExecutor() {
+  {
+    std::lock_guard lock(_sleepMutex);
+    _stopping = true;
+  }
+  for (auto& wake : _wake) {
+    wake.notify_all();
+  }
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+bool CryptoExecutor::submit(Priority priority, std::function<void()> job) {
+  auto lane = static_cast<size_t>(priority);
+  if (priority == Priority::Background && _queuedBackground.fetch_add(1) >= _maxQueuedBackground.load()) {
+    _queuedBackground.fetch_sub(1);
+    return false;
+  }
+
+  auto& queue = *_queues[_nextQueue.fetch_add(1) % _queues.size()];
+  {
+    std::lock_guard lock(queue.mutex);
+    queue.lanes[lane].push_back(std::move(job));
+  }
+  _pending[lane]++;
+  wakeOne(priority);
+  return true;
+}
+
+void CryptoExecutor::wakeOne(Priority priority) {
+  // Interactive jobs go to the reserved worker first, background jobs can only wake a general worker
+  for (auto group : {Group::InteractiveOnly, Group::General}) {
+    if (group == Group::InteractiveOnly && priority == Priority::Background) {
+      continue;
+    }
+    if (_idle[group] > 0) {
+      {
+        // Taking the lock orders the notification after the sleeper has started waiting
+        std::lock_guard lock(_sleepMutex);
+      }
+      _wake[group].notify_one();
+      return;
+    }
+  }
+}
+
+void CryptoExecutor::setMaxQueuedBackgroundJobs(size_t limit) {
+  _maxQueuedBackground = limit;
+}
+
+bool CryptoExecutor::acceptsBackground(size_t index) const {
+  return index != 0 || _queues.size() == 1;
+}
+
+bool CryptoExecutor::hasWork(Group group) const {
+  return _pending[0] > 0 || (group == Group::General && _pending[1] > 0);
+}
+
+bool CryptoExecutor::tryTake(size_t index, std::function<void()>& job) {
+  for (size_t lane = 0; lane < 2; ++lane) {
+    if (lane == static_cast<size_t>(Priority::Background) && !acceptsBackground(index)) {
+      break;
+    }
+    // Start with our own queue, then steal from the others
+    for (size_t offset = 0; offset < _queues.size(); ++offset) {
+      auto& queue = *_queues[(index + offset) % _queues.size()];
+      {
+        std::lock_guard lock(queue.mutex);
+        auto& jobs = queue.lanes[lane];
+        if (jobs.empty()) {
+          continue;
+        }
+        job = std::move(jobs.front());
+        jobs.pop_front();
+      }
+      _pending[lane]--;
+      if (lane == static_cast<size_t>(Priority::Background)) {
+        _queuedBackground.fetch_sub(1);
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+void CryptoExecutor::workerLoop(size_t index) {
+  while (true) {
+    std::function<void()> job;
+    if (tryTake(index, job)) {
+      job();
+      continue;
+    }
+
+    auto group = acceptsBackground(index) ? Group::General : Group::InteractiveOnly;
+    std::unique_lock lock(_sleepMutex);
+    _idle[group]++;
+    _wake[group].wait(lock, [&] { return _stopping || hasWork(group); });
+    _idle[group]--;
+    if (_stopping) {
+      return;
+    }
+  }
+}
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "HybridCancellationTokenSpec.hpp"
+#include <NitroModules/Promise.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace margelo::nitro::provable {
+
+// Work-stealing pool dedicated to the SDK's crypto jobs, shared by every JS runtime in the process.
+// Interactive jobs (user-initiated signing and derivation) are always taken before background jobs, and worker 0 only
+// runs interactive jobs so a flood of background verifies can never delay a signature. The background lane is bounded,
+// jobs beyond the limit are rejected instead of queued.
+// Submitting only takes the target queue's lock, and wakes a single sleeping worker if there is one, so several runtimes
+// submitting at once don't serialize on a global lock while the workers are busy.
+class CryptoExecutor {
+ public:
+  enum class Priority { Interactive = 0, Background = 1 };
+
+  static CryptoExecutor& shared();
+
+  explicit CryptoExecutor(size_t workerCount);
+  ~CryptoExecutor();
+
+  bool submit(Priority priority, std::function<void()> job);
+  void setMaxQueuedBackgroundJobs(size_t limit);
+
+  template <typename T>
+  std::shared_ptr<Promise<T>> run(Priority priority, const std::shared_ptr<HybridCancellationTokenSpec>& token, std::function<T()> job) {
+    auto promise = Promise<T>::create();
+    bool accepted = submit(priority, [promise, token, job = std::move(job)]() {
+      if (token != nullptr && token->getIsCancelled()) {
+        promise->reject(std::make_exception_ptr(std::runtime_error("Operation was cancelled")));
+        return;
+      }
+      try {
+        if constexpr (std::is_void_v<T>) {
+          job();
+          promise->resolve();
+        } else {
+          promise->resolve(job());
+        }
+      } catch (...) {
+        promise->reject(std::current_exception());
+      }
+    });
+    if (!accepted) {
+      promise->reject(std::make_exception_ptr(std::runtime_error("Too many queued crypto operations")));
+    }
+    return promise;
+  }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> lanes[2];
+  };
+
+  // Sleeping workers wait in one of two groups: the interactive-only worker 0, or the workers that take both lanes
+  enum Group { InteractiveOnly = 0, General = 1 };
+
+  void workerLoop(size_t index);
+  bool tryTake(size_t index, std::function<void()>& job);
+  bool acceptsBackground(size_t index) const;
+  bool hasWork(Group group) const;
+  void wakeOne(Priority priority);
+
+  std::vector<std::unique_ptr<Queue>> _queues;
+  std::vector<std::thread> _workers;
+  std::atomic<size_t> _nextQueue{0};
+  std::atomic<size_t> _queuedBackground{0};
+  std::atomic<size_t> _maxQueuedBackground{256};
+
+  // `_pending` and `_idle` are sequentially consistent: a submitter increments `_pending` then reads `_idle`, and a
+  // worker increments `_idle` then reads `_pending` under `_sleepMutex`, so either the submitter sees the sleeper or
+  // the worker sees the job
+  std::mutex _sleepMutex;
+  std::condition_variable _wake[2];
+  std::atomic<std::ptrdiff_t> _pending[2] = {0, 0};
+  std::atomic<size_t> _idle[2] = {0, 0};
+  bool _stopping = false;
+};
+
+} // namespace margelo::nitro::provable
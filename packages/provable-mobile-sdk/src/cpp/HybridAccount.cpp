@@ -1,250 +1,372 @@
 #include "HybridAccount.hpp"
-#include <NitroModules/ArrayBuffer.hpp>
-#include <NitroModules/Promise.hpp>
+#include "ArrayBufferUtils.hpp"
+#include "CryptoExecutor.hpp"
+#include "HybridAddress.hpp"
+#include "HybridCancellationToken.hpp"
+#include "HybridEncodedMessage.hpp"
+#include "HybridPrivateKey.hpp"
+#include "HybridVanitySearch.hpp"
+#include "HybridViewKey.hpp"
+#include "SecretArena.hpp"
+#include <algorithm>
+#include <cmath>
 #include <cstring>
-#include <vector>
-
-// Include generated struct headers
-#include "PrivateKey.hpp"
-#include "Address.hpp"
-#include "ViewKey.hpp"
+#include <limits>
+#include <thread>
 
 // Include generated Rust cxx bridge header
 #include "rust/lib.rs.h"
 
-using namespace NitroModules;
-using namespace margelo::nitro::provable;
-
 namespace margelo::nitro::provable {
 
-// Rust FFI wrapper implementations using cxx bridge
-std::string HybridAccount::rustCreatePrivateKey() {
-  auto handle = create_private_key();
-  auto result = private_key_to_string(handle);
-  destroy_private_key(handle);
-  
-  if (result.success) {
-    return std::string(result.result);
-  } else {
-    throw std::runtime_error(std::string(result.error));
+static OperationStats toOperationStats(const OperationCounters& counters) {
+  auto micros = [](uint64_t nanos) { return static_cast<double>(nanos) / 1000.0; };
+  double mean = counters.count == 0 ? 0 : micros(counters.total_nanos) / static_cast<double>(counters.count);
+  return OperationStats(static_cast<double>(counters.count), micros(counters.total_nanos), mean, micros(counters.p50_nanos),
+                        micros(counters.p90_nanos), micros(counters.p99_nanos), micros(counters.max_nanos));
+}
+
+static RegistryStats toRegistryStats(const RegistryCounters& counters) {
+  return RegistryStats(static_cast<double>(counters.live_handles), static_cast<double>(counters.lock_wait_nanos) / 1000.0);
+}
+
+template <typename T, typename Spec>
+static std::shared_ptr<T> native(const std::shared_ptr<Spec>& object, const char* name) {
+  auto result = std::dynamic_pointer_cast<T>(object);
+  if (result == nullptr) {
+    throw std::invalid_argument(std::string(name) + " was not created by this SDK");
   }
+  return result;
 }
 
-bool HybridAccount::rustValidatePrivateKey(const std::string& privateKey) {
-  return validate_private_key(rust::String(privateKey));
+// Wraps the handles returned by a bulk validation, each new object takes ownership of its handle
+template <typename T, typename Spec, typename Handle>
+static std::vector<std::shared_ptr<Spec>> wrapHandles(const rust::Vec<uint64_t>& ids) {
+  std::vector<std::shared_ptr<Spec>> objects;
+  objects.reserve(ids.size());
+  for (auto id : ids) {
+    objects.push_back(std::make_shared<T>(Handle{id}));
+  }
+  return objects;
 }
 
-std::string HybridAccount::rustPrivateKeyToAddress(const std::string& privateKey) {
-  auto pkHandle = private_key_from_string(rust::String(privateKey));
-  if (pkHandle.id == 0) {
-    throw std::invalid_argument("Invalid private key");
+// Packs secret strings in the offsets layout `unpack_with_offsets` reads, into a buffer that is sized up front so it never
+// reallocates and is wiped when the last reference is released
+static std::shared_ptr<std::vector<uint8_t>> packSecrets(const std::vector<std::string>& strings) {
+  size_t size = 4 * (strings.size() + 2);
+  for (const auto& string : strings) {
+    size += string.size();
   }
-  
-  auto addrHandle = private_key_to_address(pkHandle);
-  auto result = address_to_string(addrHandle);
-  
-  destroy_private_key(pkHandle);
-  destroy_address(addrHandle);
-  
-  if (result.success) {
-    return std::string(result.result);
-  } else {
-    throw std::runtime_error(std::string(result.error));
+  if (size > std::numeric_limits<uint32_t>::max()) {
+    throw std::invalid_argument("Too many keys to pass in one call");
+  }
+  std::shared_ptr<std::vector<uint8_t>> packed(new std::vector<uint8_t>(size), [](std::vector<uint8_t>* bytes) {
+    secureWipe(bytes->data(), bytes->size());
+    delete bytes;
+  });
+  auto writeU32 = [&](size_t index, size_t value) {
+    auto word = static_cast<uint32_t>(value);
+    for (size_t i = 0; i < 4; ++i) {
+      (*packed)[4 * index + i] = static_cast<uint8_t>(word >> (8 * i));
+    }
+  };
+  writeU32(0, strings.size());
+  size_t offset = 4 * (strings.size() + 2);
+  writeU32(1, offset);
+  for (size_t i = 0; i < strings.size(); ++i) {
+    std::memcpy(packed->data() + offset, strings[i].data(), strings[i].size());
+    offset += strings[i].size();
+    writeU32(i + 2, offset);
+  }
+  return packed;
+}
+
+// Account creation methods
+std::shared_ptr<HybridPrivateKeySpec> HybridAccount::createPrivateKey() {
+  return std::make_shared<HybridPrivateKey>(create_private_key());
+}
+
+std::shared_ptr<HybridPrivateKeySpec> HybridAccount::privateKeyFromString(const std::string& privateKey) {
+  auto handle = private_key_from_string(rust::Str(privateKey));
+  if (handle.id == 0) {
+    throw std::invalid_argument("Invalid private key format");
   }
+  return std::make_shared<HybridPrivateKey>(handle);
 }
 
-std::string HybridAccount::rustPrivateKeyToViewKey(const std::string& privateKey) {
-  auto pkHandle = private_key_from_string(rust::String(privateKey));
-  if (pkHandle.id == 0) {
-    throw std::invalid_argument("Invalid private key");
+std::shared_ptr<HybridAddressSpec> HybridAccount::addressFromString(const std::string& address) {
+  auto handle = address_from_string(rust::Str(address));
+  if (handle.id == 0) {
+    throw std::invalid_argument("Invalid address format");
   }
-  
-  auto vkHandle = private_key_to_view_key(pkHandle);
-  auto result = view_key_to_string(vkHandle);
-  
-  destroy_private_key(pkHandle);
-  destroy_view_key(vkHandle);
-  
-  if (result.success) {
-    return std::string(result.result);
-  } else {
-    throw std::runtime_error(std::string(result.error));
+  return std::make_shared<HybridAddress>(handle);
+}
+
+std::shared_ptr<HybridViewKeySpec> HybridAccount::viewKeyFromString(const std::string& viewKey) {
+  auto handle = view_key_from_string(rust::Str(viewKey));
+  if (handle.id == 0) {
+    throw std::invalid_argument("Invalid view key format");
   }
+  return std::make_shared<HybridViewKey>(handle);
 }
 
-std::shared_ptr<ArrayBuffer> HybridAccount::rustPrivateKeySign(const std::string& privateKey, const uint8_t* message,
-                                                                             size_t messageLen) {
-  auto pkHandle = private_key_from_string(rust::String(privateKey));
-  if (pkHandle.id == 0) {
-    throw std::invalid_argument("Invalid private key");
+std::shared_ptr<HybridPrivateKeySpec> HybridAccount::privateKeyFromBytes(const std::shared_ptr<ArrayBuffer>& bytes) {
+  auto handle = private_key_from_bytes(asSlice(bytes));
+  if (handle.id == 0) {
+    throw std::invalid_argument("Invalid private key bytes: expected a " + std::to_string(private_key_size_in_bytes()) + "-byte seed");
   }
-  
-  // Convert message to rust::Vec<uint8_t>
-  rust::Vec<uint8_t> messageVec;
-  for (size_t i = 0; i < messageLen; ++i) {
-    messageVec.push_back(message[i]);
+  return std::make_shared<HybridPrivateKey>(handle);
+}
+
+std::shared_ptr<HybridAddressSpec> HybridAccount::addressFromBytes(const std::shared_ptr<ArrayBuffer>& bytes) {
+  auto handle = address_from_bytes(asSlice(bytes));
+  if (handle.id == 0) {
+    throw std::invalid_argument("Invalid address bytes: expected a " + std::to_string(address_size_in_bytes()) + "-byte point on the curve");
   }
+  return std::make_shared<HybridAddress>(handle);
+}
 
-  auto result = private_key_sign(pkHandle, messageVec);
-  destroy_private_key(pkHandle);
-  
-  if (result.success) {
-    auto buffer = ArrayBuffer::allocate(result.signature_bytes.size());
-    std::memcpy(buffer->data(), result.signature_bytes.data(), result.signature_bytes.size());
-    return buffer;
-  } else {
-    throw std::runtime_error(std::string(result.error));
+std::shared_ptr<HybridViewKeySpec> HybridAccount::viewKeyFromBytes(const std::shared_ptr<ArrayBuffer>& bytes) {
+  auto handle = view_key_from_bytes(asSlice(bytes));
+  if (handle.id == 0) {
+    throw std::invalid_argument("Invalid view key bytes: expected a " + std::to_string(view_key_size_in_bytes()) + "-byte scalar");
   }
+  return std::make_shared<HybridViewKey>(handle);
+}
+
+// Conversion methods
+std::shared_ptr<HybridAddressSpec> HybridAccount::addressFromPrivateKey(const std::shared_ptr<HybridPrivateKeySpec>& privateKey) {
+  return native<HybridPrivateKey>(privateKey, "PrivateKey")->deriveAddress();
+}
+
+std::shared_ptr<HybridViewKeySpec> HybridAccount::viewKeyFromPrivateKey(const std::shared_ptr<HybridPrivateKeySpec>& privateKey) {
+  return native<HybridPrivateKey>(privateKey, "PrivateKey")->deriveViewKey();
 }
 
-bool HybridAccount::rustValidateAddress(const std::string& address) {
-  return validate_address(rust::String(address));
+std::shared_ptr<HybridAddressSpec> HybridAccount::addressFromViewKey(const std::shared_ptr<HybridViewKeySpec>& viewKey) {
+  return native<HybridViewKey>(viewKey, "ViewKey")->deriveAddress();
 }
 
-bool HybridAccount::rustAddressVerify(const std::string& address, const uint8_t* signature, size_t signatureLen, const uint8_t* message,
-                                      size_t messageLen) {
-  auto addrHandle = address_from_string(rust::String(address));
-  if (addrHandle.id == 0) {
-    return false;
+// Message encoding methods
+std::shared_ptr<HybridEncodedMessageSpec> HybridAccount::encodeMessage(const std::shared_ptr<ArrayBuffer>& message) {
+  auto handle = encoded_message_from_bytes(asSlice(message));
+  if (handle.id == 0) {
+    throw std::invalid_argument("Invalid message: it exceeds the maximum size that can be signed");
   }
-  
-  // Convert signature and message to rust::Vec<uint8_t>
-  rust::Vec<uint8_t> signatureVec;
-  for (size_t i = 0; i < signatureLen; ++i) {
-    signatureVec.push_back(signature[i]);
-  }
-  
-  rust::Vec<uint8_t> messageVec;
-  for (size_t i = 0; i < messageLen; ++i) {
-    messageVec.push_back(message[i]);
+  return std::make_shared<HybridEncodedMessage>(handle);
+}
+
+std::shared_ptr<HybridEncodedMessageSpec> HybridAccount::encodedMessageFromFields(const std::shared_ptr<ArrayBuffer>& fields) {
+  auto handle = encoded_message_from_fields(asSlice(fields));
+  if (handle.id == 0) {
+    throw std::invalid_argument("Invalid field elements: expected " + std::to_string(HybridEncodedMessage::kFieldSize) +
+                                "-byte little-endian values below the field modulus, up to the maximum message size, "
+                                "not starting with the largest field element");
   }
+  return std::make_shared<HybridEncodedMessage>(handle);
+}
 
-  bool result = address_verify(addrHandle, signatureVec, messageVec);
-  destroy_address(addrHandle);
-  return result;
+// Batch methods
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+HybridAccount::verifyBatch(const std::shared_ptr<ArrayBuffer>& triples, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  auto data = retainForAsync(triples);
+  return CryptoExecutor::shared().run<std::shared_ptr<ArrayBuffer>>(
+      CryptoExecutor::Priority::Background, token.value_or(nullptr), [data]() -> std::shared_ptr<ArrayBuffer> {
+        auto result = address_verify_batch(asSlice(data));
+        if (!result.success) {
+          throw std::invalid_argument(std::string(result.error));
+        }
+        return toArrayBuffer(result.bytes);
+      });
 }
 
-bool HybridAccount::rustValidateViewKey(const std::string& viewKey) {
-  return validate_view_key(rust::String(viewKey));
-}
-
-std::string HybridAccount::rustViewKeyToAddress(const std::string& viewKey) {
-  auto vkHandle = view_key_from_string(rust::String(viewKey));
-  if (vkHandle.id == 0) {
-    throw std::invalid_argument("Invalid view key");
-  }
-  
-  auto addrHandle = view_key_to_address(vkHandle);
-  auto result = address_to_string(addrHandle);
-  
-  destroy_view_key(vkHandle);
-  destroy_address(addrHandle);
-  
-  if (result.success) {
-    return std::string(result.result);
-  } else {
-    throw std::runtime_error(std::string(result.error));
-  }
-}
-
-// Create PrivateKey struct with bound functions
-PrivateKey HybridAccount::createPrivateKeyStruct(const std::string& privateKeyString) {
-  return PrivateKey(
-      // toString function
-      [privateKeyString]() -> std::shared_ptr<Promise<std::string>> {
-        return Promise<std::string>::resolved(std::string(privateKeyString));
-      },
-      // toAddress function
-      [this, privateKeyString]() -> std::shared_ptr<Promise<Address>> {
-        std::string addressString = rustPrivateKeyToAddress(privateKeyString);
-        Address address = createAddressStruct(addressString);
-        return Promise<Address>::resolved(std::move(address));
-      },
-      // toViewKey function
-      [this, privateKeyString]() -> std::shared_ptr<Promise<ViewKey>> {
-        std::string viewKeyString = rustPrivateKeyToViewKey(privateKeyString);
-        ViewKey viewKey = createViewKeyStruct(viewKeyString);
-        return Promise<ViewKey>::resolved(std::move(viewKey));
-      },
-      // sign function
-      [this, privateKeyString](const std::shared_ptr<ArrayBuffer>& message) -> std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> {
-        auto signature = rustPrivateKeySign(privateKeyString, message->data(), message->size());
-        return Promise<std::shared_ptr<ArrayBuffer>>::resolved(std::move(signature));
+std::shared_ptr<Promise<AddressValidation>>
+HybridAccount::validateAddresses(const std::shared_ptr<ArrayBuffer>& addresses, std::optional<bool> parse,
+                                 const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  auto data = retainForAsync(addresses);
+  return CryptoExecutor::shared().run<AddressValidation>(
+      CryptoExecutor::Priority::Background, token.value_or(nullptr), [data, parse = parse.value_or(false)]() -> AddressValidation {
+        auto result = validate_addresses(asSlice(data), parse);
+        if (!result.success) {
+          throw std::invalid_argument(std::string(result.error));
+        }
+        return AddressValidation(toArrayBuffer(result.bitmap), wrapHandles<HybridAddress, HybridAddressSpec, AddressHandle>(result.handles));
       });
 }
 
-// Create Address struct with bound functions
-Address HybridAccount::createAddressStruct(const std::string& addressString) {
-  return Address(
-      // toString function
-      [addressString]() -> std::shared_ptr<Promise<std::string>> {
-        return Promise<std::string>::resolved(std::string(addressString));
-      },
-      // verify function
-      [this, addressString](const std::shared_ptr<ArrayBuffer>& signature,
-                            const std::shared_ptr<ArrayBuffer>& message) -> std::shared_ptr<Promise<bool>> {
-        // Copy buffer data for async operation (non-owning buffers)
-        std::vector<uint8_t> sigData(signature->data(), signature->data() + signature->size());
-        std::vector<uint8_t> msgData(message->data(), message->data() + message->size());
-        return Promise<bool>::async([this, addressString, sigData, msgData]() -> bool {
-          return rustAddressVerify(addressString, sigData.data(), sigData.size(), msgData.data(), msgData.size());
-        });
+std::shared_ptr<Promise<PrivateKeyValidation>>
+HybridAccount::validatePrivateKeys(const std::shared_ptr<ArrayBuffer>& privateKeys, std::optional<bool> parse,
+                                   const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  auto data = retainForAsync(privateKeys);
+  return CryptoExecutor::shared().run<PrivateKeyValidation>(
+      CryptoExecutor::Priority::Background, token.value_or(nullptr), [data, parse = parse.value_or(false)]() -> PrivateKeyValidation {
+        auto result = validate_private_keys(asSlice(data), parse);
+        if (!result.success) {
+          throw std::invalid_argument(std::string(result.error));
+        }
+        return PrivateKeyValidation(toArrayBuffer(result.bitmap),
+                                    wrapHandles<HybridPrivateKey, HybridPrivateKeySpec, PrivateKeyHandle>(result.handles));
       });
 }
 
-// Create ViewKey struct with bound functions
-ViewKey HybridAccount::createViewKeyStruct(const std::string& viewKeyString) {
-  return ViewKey(
-      // toString function
-      [viewKeyString]() -> std::shared_ptr<Promise<std::string>> {
-        return Promise<std::string>::resolved(std::string(viewKeyString));
-      },
-      // toAddress function
-      [this, viewKeyString]() -> std::shared_ptr<Promise<Address>> {
-        std::string addressString = rustViewKeyToAddress(viewKeyString);
-        Address address = createAddressStruct(addressString);
-        return Promise<Address>::resolved(std::move(address));
+std::shared_ptr<Promise<ViewKeyValidation>>
+HybridAccount::validateViewKeys(const std::shared_ptr<ArrayBuffer>& viewKeys, std::optional<bool> parse,
+                                const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  auto data = retainForAsync(viewKeys);
+  return CryptoExecutor::shared().run<ViewKeyValidation>(
+      CryptoExecutor::Priority::Background, token.value_or(nullptr), [data, parse = parse.value_or(false)]() -> ViewKeyValidation {
+        auto result = validate_view_keys(asSlice(data), parse);
+        if (!result.success) {
+          throw std::invalid_argument(std::string(result.error));
+        }
+        return ViewKeyValidation(toArrayBuffer(result.bitmap), wrapHandles<HybridViewKey, HybridViewKeySpec, ViewKeyHandle>(result.handles));
       });
 }
 
-// Account creation methods
-PrivateKey HybridAccount::createPrivateKey() {
-  std::string privateKeyString = rustCreatePrivateKey();
-  return createPrivateKeyStruct(privateKeyString);
+// Scheduling methods
+std::shared_ptr<HybridCancellationTokenSpec> HybridAccount::createCancellationToken() {
+  return std::make_shared<HybridCancellationToken>();
 }
 
-PrivateKey HybridAccount::privateKeyFromString(const std::string& privateKey) {
-  if (!rustValidatePrivateKey(privateKey)) {
-    throw std::invalid_argument("Invalid private key format");
+void HybridAccount::setMaxQueuedJobs(double limit) {
+  if (limit < 1) {
+    throw std::invalid_argument("The queue limit must be at least 1");
   }
-  return createPrivateKeyStruct(privateKey);
+  CryptoExecutor::shared().setMaxQueuedBackgroundJobs(static_cast<size_t>(limit));
 }
 
-Address HybridAccount::addressFromString(const std::string& address) {
-  if (!rustValidateAddress(address)) {
-    throw std::invalid_argument("Invalid address format");
+// Cache methods
+void HybridAccount::setDerivationCacheSize(double size) {
+  if (size < 0) {
+    throw std::invalid_argument("The cache size must not be negative");
   }
-  return createAddressStruct(address);
+  set_derivation_cache_capacity(static_cast<size_t>(size));
 }
 
-ViewKey HybridAccount::viewKeyFromString(const std::string& viewKey) {
-  if (!rustValidateViewKey(viewKey)) {
-    throw std::invalid_argument("Invalid view key format");
+DerivationCacheStats HybridAccount::getDerivationCacheStats() {
+  auto stats = derivation_cache_stats();
+  return DerivationCacheStats(static_cast<double>(stats.hits), static_cast<double>(stats.misses), static_cast<double>(stats.size),
+                              static_cast<double>(stats.capacity));
+}
+
+void HybridAccount::setAddressCacheSize(double size) {
+  if (size < 0) {
+    throw std::invalid_argument("The cache size must not be negative");
   }
-  return createViewKeyStruct(viewKey);
+  set_address_cache_capacity(static_cast<size_t>(size));
 }
 
-// Conversion methods
-Address HybridAccount::addressFromPrivateKey(const PrivateKey& privateKey) {
-  throw std::runtime_error("Cannot access synchronous methods on Nitro structs - use privateKey.toAddress() instead");
+std::shared_ptr<Promise<double>> HybridAccount::warmAddressCache(const std::vector<std::string>& addresses) {
+  rust::Vec<rust::String> strings;
+  strings.reserve(addresses.size());
+  for (const auto& address : addresses) {
+    strings.push_back(rust::String(address));
+  }
+  return CryptoExecutor::shared().run<double>(CryptoExecutor::Priority::Background, nullptr, [strings = std::move(strings)]() mutable -> double {
+    return static_cast<double>(warm_address_cache(std::move(strings)));
+  });
+}
+
+void HybridAccount::setNoncePoolSize(double depth, std::optional<double> refillBelow) {
+  if (depth < 0 || refillBelow.value_or(0) < 0) {
+    throw std::invalid_argument("The nonce pool size must not be negative");
+  }
+  // Refill once half the pool has been used unless told otherwise
+  auto threshold = refillBelow.value_or(std::max(1.0, std::floor(depth / 2)));
+  set_nonce_pool(static_cast<size_t>(depth), static_cast<size_t>(threshold));
+}
+
+NoncePoolStats HybridAccount::getNoncePoolStats() {
+  auto stats = nonce_pool_stats();
+  return NoncePoolStats(static_cast<double>(stats.available), static_cast<double>(stats.depth), static_cast<double>(stats.pooled_signatures),
+                        static_cast<double>(stats.inline_signatures));
+}
+
+// Signing methods
+std::shared_ptr<Promise<void>> HybridAccount::prepareSigningContext() {
+  return CryptoExecutor::shared().run<void>(CryptoExecutor::Priority::Interactive, nullptr, []() { prepare_signing_context(); });
+}
+
+std::shared_ptr<Promise<WarmUpStats>> HybridAccount::warmUp() {
+  return CryptoExecutor::shared().run<WarmUpStats>(CryptoExecutor::Priority::Interactive, nullptr, []() -> WarmUpStats {
+    auto timings = warm_up();
+    auto millis = [](uint64_t nanos) { return static_cast<double>(nanos) / 1000000.0; };
+    return WarmUpStats(millis(timings.registries_nanos), millis(timings.network_nanos), millis(timings.signing_context_nanos),
+                       millis(timings.thread_pool_nanos), millis(timings.total_nanos));
+  });
+}
+
+void HybridAccount::startWarmUp() {
+  std::thread([]() { warm_up(); }).detach();
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridAccount::deriveAccounts(const std::shared_ptr<ArrayBuffer>& seed, double startIndex,
+                                                                                     double count) {
+  auto isIndex = [](double value) { return value >= 0 && value <= std::numeric_limits<uint32_t>::max() && value == std::floor(value); };
+  if (!isIndex(startIndex) || !isIndex(count)) {
+    throw std::invalid_argument("The account index range must be unsigned 32-bit integers");
+  }
+  auto data = retainForAsync(seed);
+  auto start = static_cast<uint32_t>(startIndex);
+  auto length = static_cast<uint32_t>(count);
+  return CryptoExecutor::shared().run<std::shared_ptr<ArrayBuffer>>(
+      CryptoExecutor::Priority::Background, nullptr, [data, start, length]() -> std::shared_ptr<ArrayBuffer> {
+        auto result = derive_accounts(asSlice(data), start, length);
+        if (!result.success) {
+          throw std::invalid_argument(std::string(result.error));
+        }
+        // The packed key strings now live in the returned buffer, don't leave them behind in Rust's
+        auto accounts = toArrayBuffer(result.bytes);
+        secureWipe(result.bytes.data(), result.bytes.size());
+        return accounts;
+      });
+}
+
+std::shared_ptr<Promise<RestoredAccounts>> HybridAccount::restoreAccounts(const std::string& path, const std::shared_ptr<ArrayBuffer>& secret,
+                                                                           const std::vector<std::string>& privateKeys) {
+  auto data = retainForAsync(secret);
+  auto packed = packSecrets(privateKeys);
+  return CryptoExecutor::shared().run<RestoredAccounts>(
+      CryptoExecutor::Priority::Interactive, nullptr, [path, data, packed]() -> RestoredAccounts {
+        auto result = restore_accounts(rust::Str(path), asSlice(data), rust::Slice<const uint8_t>(packed->data(), packed->size()));
+        if (!result.success) {
+          throw std::invalid_argument(std::string(result.error));
+        }
+        std::vector<RestoredAccount> accounts;
+        accounts.reserve(result.accounts.size());
+        for (const auto& account : result.accounts) {
+          accounts.emplace_back(std::make_shared<HybridPrivateKey>(account.private_key), std::make_shared<HybridViewKey>(account.view_key),
+                                std::make_shared<HybridAddress>(account.address));
+        }
+        return RestoredAccounts(std::move(accounts), static_cast<double>(result.cached), static_cast<double>(result.derived));
+      });
+}
+
+std::shared_ptr<HybridVanitySearchSpec> HybridAccount::startVanitySearch(const std::string& prefix, const std::string& suffix) {
+  auto handle = vanity_search_new(rust::String(prefix), rust::String(suffix));
+  if (handle.id == 0) {
+    throw std::invalid_argument("Invalid vanity pattern: it must fit in 58 characters from qpzry9x8gf2tvdw0s3jn54khce6mua7l");
+  }
+  auto search = std::make_shared<HybridVanitySearch>(handle);
+  search->start(std::max(1u, std::thread::hardware_concurrency()));
+  return search;
+}
+
+// Stats methods
+void HybridAccount::setStatsEnabled(bool enabled) {
+  set_stats_enabled(enabled);
 }
 
-ViewKey HybridAccount::viewKeyFromPrivateKey(const PrivateKey& privateKey) {
-  throw std::runtime_error("Cannot access synchronous methods on Nitro structs - use privateKey.toViewKey() instead");
+SdkStats HybridAccount::getStats() {
+  auto stats = stats_snapshot();
+  return SdkStats(stats.enabled, toOperationStats(stats.parse), toOperationStats(stats.derive), toOperationStats(stats.sign),
+                  toOperationStats(stats.verify), toOperationStats(stats.batch), toOperationStats(stats.marshal),
+                  toRegistryStats(stats.private_keys), toRegistryStats(stats.addresses), toRegistryStats(stats.view_keys),
+                  toRegistryStats(stats.streams), toRegistryStats(stats.vanity_searches), static_cast<double>(stats.bytes_copied));
 }
 
-Address HybridAccount::addressFromViewKey(const ViewKey& viewKey) {
-  throw std::runtime_error("Cannot access synchronous methods on Nitro structs - use viewKey.toAddress() instead");
+void HybridAccount::resetStats() {
+  reset_stats();
 }
 
 } // namespace margelo::nitro::provable
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "HybridAccountSpec.hpp"
-#include <NitroModules/ArrayBuffer.hpp>
 
 namespace margelo::nitro::provable {
 
@@ -9,36 +8,61 @@ class HybridAccount : public HybridAccountSpec {
  public:
   explicit HybridAccount() : HybridObject(TAG) {}
 
+  // Starts warm-up on a thread of its own without waiting for it, for the platform library load hooks
+  static void startWarmUp();
+
   // Account creation methods
-  PrivateKey createPrivateKey() override;
-  PrivateKey privateKeyFromString(const std::string& privateKey) override;
-  Address addressFromString(const std::string& address) override;
-  ViewKey viewKeyFromString(const std::string& viewKey) override;
+  std::shared_ptr<HybridPrivateKeySpec> createPrivateKey() override;
+  std::shared_ptr<HybridPrivateKeySpec> privateKeyFromString(const std::string& privateKey) override;
+  std::shared_ptr<HybridAddressSpec> addressFromString(const std::string& address) override;
+  std::shared_ptr<HybridViewKeySpec> viewKeyFromString(const std::string& viewKey) override;
+  std::shared_ptr<HybridPrivateKeySpec> privateKeyFromBytes(const std::shared_ptr<ArrayBuffer>& bytes) override;
+  std::shared_ptr<HybridAddressSpec> addressFromBytes(const std::shared_ptr<ArrayBuffer>& bytes) override;
+  std::shared_ptr<HybridViewKeySpec> viewKeyFromBytes(const std::shared_ptr<ArrayBuffer>& bytes) override;
 
   // Conversion methods
-  Address addressFromPrivateKey(const PrivateKey& privateKey) override;
-  ViewKey viewKeyFromPrivateKey(const PrivateKey& privateKey) override;
-  Address addressFromViewKey(const ViewKey& viewKey) override;
-
- private:
-  // Helper methods to create structs with bound functions
-  PrivateKey createPrivateKeyStruct(const std::string& privateKeyString);
-  Address createAddressStruct(const std::string& addressString);
-  ViewKey createViewKeyStruct(const std::string& viewKeyString);
-
-  // Rust FFI wrapper functions
-  std::string rustCreatePrivateKey();
-  bool rustValidatePrivateKey(const std::string& privateKey);
-  std::string rustPrivateKeyToAddress(const std::string& privateKey);
-  std::string rustPrivateKeyToViewKey(const std::string& privateKey);
-  std::shared_ptr<ArrayBuffer> rustPrivateKeySign(const std::string& privateKey, const uint8_t* message, size_t messageLen);
-
-  bool rustValidateAddress(const std::string& address);
-  bool rustAddressVerify(const std::string& address, const uint8_t* signature, size_t signatureLen, const uint8_t* message,
-                         size_t messageLen);
-
-  bool rustValidateViewKey(const std::string& viewKey);
-  std::string rustViewKeyToAddress(const std::string& viewKey);
+  std::shared_ptr<HybridAddressSpec> addressFromPrivateKey(const std::shared_ptr<HybridPrivateKeySpec>& privateKey) override;
+  std::shared_ptr<HybridViewKeySpec> viewKeyFromPrivateKey(const std::shared_ptr<HybridPrivateKeySpec>& privateKey) override;
+  std::shared_ptr<HybridAddressSpec> addressFromViewKey(const std::shared_ptr<HybridViewKeySpec>& viewKey) override;
+
+  // Message encoding methods
+  std::shared_ptr<HybridEncodedMessageSpec> encodeMessage(const std::shared_ptr<ArrayBuffer>& message) override;
+  std::shared_ptr<HybridEncodedMessageSpec> encodedMessageFromFields(const std::shared_ptr<ArrayBuffer>& fields) override;
+
+  // Batch methods
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+  verifyBatch(const std::shared_ptr<ArrayBuffer>& triples, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+  std::shared_ptr<Promise<AddressValidation>> validateAddresses(const std::shared_ptr<ArrayBuffer>& addresses, std::optional<bool> parse,
+                                                                const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+  std::shared_ptr<Promise<PrivateKeyValidation>> validatePrivateKeys(const std::shared_ptr<ArrayBuffer>& privateKeys, std::optional<bool> parse,
+                                                                     const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+  std::shared_ptr<Promise<ViewKeyValidation>> validateViewKeys(const std::shared_ptr<ArrayBuffer>& viewKeys, std::optional<bool> parse,
+                                                               const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+
+  // Scheduling methods
+  std::shared_ptr<HybridCancellationTokenSpec> createCancellationToken() override;
+  void setMaxQueuedJobs(double limit) override;
+
+  // Cache methods
+  void setDerivationCacheSize(double size) override;
+  DerivationCacheStats getDerivationCacheStats() override;
+  void setAddressCacheSize(double size) override;
+  std::shared_ptr<Promise<double>> warmAddressCache(const std::vector<std::string>& addresses) override;
+  void setNoncePoolSize(double depth, std::optional<double> refillBelow) override;
+  NoncePoolStats getNoncePoolStats() override;
+
+  // Signing methods
+  std::shared_ptr<Promise<void>> prepareSigningContext() override;
+  std::shared_ptr<Promise<WarmUpStats>> warmUp() override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> deriveAccounts(const std::shared_ptr<ArrayBuffer>& seed, double startIndex, double count) override;
+  std::shared_ptr<Promise<RestoredAccounts>> restoreAccounts(const std::string& path, const std::shared_ptr<ArrayBuffer>& secret,
+                                                             const std::vector<std::string>& privateKeys) override;
+  std::shared_ptr<HybridVanitySearchSpec> startVanitySearch(const std::string& prefix, const std::string& suffix) override;
+
+  // Stats methods
+  void setStatsEnabled(bool enabled) override;
+  SdkStats getStats() override;
+  void resetStats() override;
 };
 
 } // namespace margelo::nitro::provable
@@ -0,0 +1,60 @@
+#include "HybridAddress.hpp"
+#include "ArrayBufferUtils.hpp"
+#include "CryptoExecutor.hpp"
+#include "HybridEncodedMessage.hpp"
+#include "HybridStreamingVerifier.hpp"
+
+namespace margelo::nitro::provable {
+
+HybridAddress::~HybridAddress() {
+  destroy_address(_handle);
+}
+
+std::string HybridAddress::toString() {
+  auto result = address_to_string(_handle);
+  if (!result.success) {
+    throw std::runtime_error(std::string(result.error));
+  }
+  return std::string(result.result);
+}
+
+std::shared_ptr<ArrayBuffer> HybridAddress::toBytes() {
+  return writeToArrayBuffer(address_size_in_bytes(), [this](rust::Slice<uint8_t> bytes) { return address_to_bytes(_handle, bytes); });
+}
+
+std::shared_ptr<Promise<bool>> HybridAddress::verify(const std::shared_ptr<ArrayBuffer>& signature,
+                                                     const std::shared_ptr<ArrayBuffer>& message,
+                                                     const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  // Keep this object (and its handle) alive until the verification finishes
+  return CryptoExecutor::shared().run<bool>(
+      CryptoExecutor::Priority::Background, token.value_or(nullptr),
+      [self = self(), sigData = retainForAsync(signature), msgData = retainForAsync(message)]() -> bool {
+        return address_verify(self->_handle, asSlice(sigData), asSlice(msgData));
+      });
+}
+
+std::shared_ptr<Promise<bool>> HybridAddress::verifyFields(const std::shared_ptr<ArrayBuffer>& signature,
+                                                           const std::shared_ptr<ArrayBuffer>& fields,
+                                                           const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  return CryptoExecutor::shared().run<bool>(
+      CryptoExecutor::Priority::Background, token.value_or(nullptr),
+      [self = self(), sigData = retainForAsync(signature), fields = retainForAsync(fields)]() -> bool {
+        return address_verify_fields(self->_handle, asSlice(sigData), asSlice(fields));
+      });
+}
+
+std::shared_ptr<Promise<bool>> HybridAddress::verifyEncoded(const std::shared_ptr<ArrayBuffer>& signature,
+                                                            const std::shared_ptr<HybridEncodedMessageSpec>& message,
+                                                            const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  return CryptoExecutor::shared().run<bool>(
+      CryptoExecutor::Priority::Background, token.value_or(nullptr),
+      [self = self(), sigData = retainForAsync(signature), message = HybridEncodedMessage::from(message)]() -> bool {
+        return address_verify_encoded(self->_handle, asSlice(sigData), message->handle());
+      });
+}
+
+std::shared_ptr<HybridStreamingVerifierSpec> HybridAddress::createVerifier() {
+  return std::make_shared<HybridStreamingVerifier>(self());
+}
+
+} // namespace margelo::nitro::provable
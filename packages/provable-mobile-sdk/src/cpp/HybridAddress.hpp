@@ -0,0 +1,36 @@
+#pragma once
+
+#include "HybridAddressSpec.hpp"
+#include "rust/lib.rs.h"
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::provable {
+
+class HybridAddress : public HybridAddressSpec {
+ public:
+  explicit HybridAddress(AddressHandle handle) : HybridObject(TAG), _handle(handle) {}
+  ~HybridAddress() override;
+
+  std::string toString() override;
+  std::shared_ptr<Promise<bool>> verify(const std::shared_ptr<ArrayBuffer>& signature, const std::shared_ptr<ArrayBuffer>& message,
+                                        const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+  std::shared_ptr<Promise<bool>> verifyFields(const std::shared_ptr<ArrayBuffer>& signature, const std::shared_ptr<ArrayBuffer>& fields,
+                                              const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+  std::shared_ptr<Promise<bool>> verifyEncoded(const std::shared_ptr<ArrayBuffer>& signature, const std::shared_ptr<HybridEncodedMessageSpec>& message,
+                                               const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+  std::shared_ptr<HybridStreamingVerifierSpec> createVerifier() override;
+  std::shared_ptr<ArrayBuffer> toBytes() override;
+
+  const AddressHandle& handle() const {
+    return _handle;
+  }
+
+ private:
+  std::shared_ptr<HybridAddress> self() {
+    return std::dynamic_pointer_cast<HybridAddress>(shared_from_this());
+  }
+
+  AddressHandle _handle;
+};
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "HybridCancellationTokenSpec.hpp"
+#include <atomic>
+
+namespace margelo::nitro::provable {
+
+class HybridCancellationToken : public HybridCancellationTokenSpec {
+ public:
+  explicit HybridCancellationToken() : HybridObject(TAG) {}
+
+  bool getIsCancelled() override {
+    return _cancelled.load();
+  }
+
+  void cancel() override {
+    _cancelled = true;
+  }
+
+ private:
+  std::atomic<bool> _cancelled{false};
+};
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,27 @@
+#include "HybridEncodedMessage.hpp"
+#include "ArrayBufferUtils.hpp"
+
+namespace margelo::nitro::provable {
+
+HybridEncodedMessage::~HybridEncodedMessage() {
+  destroy_encoded_message(_handle);
+}
+
+double HybridEncodedMessage::getFieldCount() {
+  return static_cast<double>(encoded_message_field_count(_handle));
+}
+
+std::shared_ptr<ArrayBuffer> HybridEncodedMessage::toFields() {
+  return writeToArrayBuffer(encoded_message_field_count(_handle) * kFieldSize,
+                            [this](rust::Slice<uint8_t> fields) { return encoded_message_to_fields(_handle, fields); });
+}
+
+std::shared_ptr<HybridEncodedMessage> HybridEncodedMessage::from(const std::shared_ptr<HybridEncodedMessageSpec>& message) {
+  auto result = std::dynamic_pointer_cast<HybridEncodedMessage>(message);
+  if (result == nullptr) {
+    throw std::invalid_argument("EncodedMessage was not created by this SDK");
+  }
+  return result;
+}
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "HybridEncodedMessageSpec.hpp"
+#include "rust/lib.rs.h"
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::provable {
+
+class HybridEncodedMessage : public HybridEncodedMessageSpec {
+ public:
+  // Every field element is packed as 32 little-endian bytes
+  static constexpr size_t kFieldSize = 32;
+
+  explicit HybridEncodedMessage(EncodedMessageHandle handle) : HybridObject(TAG), _handle(handle) {}
+  ~HybridEncodedMessage() override;
+
+  double getFieldCount() override;
+  std::shared_ptr<ArrayBuffer> toFields() override;
+
+  const EncodedMessageHandle& handle() const {
+    return _handle;
+  }
+
+  // The native object behind a message passed back in from JS
+  static std::shared_ptr<HybridEncodedMessage> from(const std::shared_ptr<HybridEncodedMessageSpec>& message);
+
+ private:
+  EncodedMessageHandle _handle;
+};
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,137 @@
+#include "HybridPrivateKey.hpp"
+#include "ArrayBufferUtils.hpp"
+#include "CryptoExecutor.hpp"
+#include "HybridAddress.hpp"
+#include "HybridEncodedMessage.hpp"
+#include "HybridStreamingSigner.hpp"
+#include "HybridViewKey.hpp"
+#include "SecretArena.hpp"
+#include <vector>
+
+namespace margelo::nitro::provable {
+
+HybridPrivateKey::~HybridPrivateKey() {
+  destroy_private_key(_handle);
+}
+
+// Formatted in a wiped arena buffer, the returned string is the only copy left for JS
+std::string HybridPrivateKey::toString() {
+  auto buffer = SecretArena::shared().lease();
+  auto length = private_key_write_string(_handle, buffer.slice());
+  if (length == 0) {
+    throw std::runtime_error("Invalid private key handle");
+  }
+  return std::string(buffer.chars(), length);
+}
+
+std::shared_ptr<ArrayBuffer> HybridPrivateKey::toBytes() {
+  return writeToArrayBuffer(private_key_size_in_bytes(), [this](rust::Slice<uint8_t> bytes) { return private_key_to_bytes(_handle, bytes); });
+}
+
+std::shared_ptr<HybridAddress> HybridPrivateKey::deriveAddress() const {
+  auto addrHandle = private_key_to_address(_handle);
+  if (addrHandle.id == 0) {
+    throw std::runtime_error("Invalid private key handle");
+  }
+  return std::make_shared<HybridAddress>(addrHandle);
+}
+
+std::shared_ptr<HybridViewKey> HybridPrivateKey::deriveViewKey() const {
+  auto vkHandle = private_key_to_view_key(_handle);
+  if (vkHandle.id == 0) {
+    throw std::runtime_error("Invalid private key handle");
+  }
+  return std::make_shared<HybridViewKey>(vkHandle);
+}
+
+// Allocates the signature buffer and fills it with `sign`, one of the `private_key_sign*` functions
+template <typename Sign>
+static std::shared_ptr<ArrayBuffer> signInto(Sign&& sign) {
+  auto signature = ArrayBuffer::allocate(signature_size_in_bytes());
+  auto status = sign(asMutableSlice(signature));
+  if (status != SignStatus::Ok) {
+    throw std::runtime_error(std::string(sign_status_message(status)));
+  }
+  return signature;
+}
+
+std::shared_ptr<ArrayBuffer> HybridPrivateKey::signBytes(const std::shared_ptr<ArrayBuffer>& message) const {
+  return signInto([&](rust::Slice<uint8_t> signature) { return private_key_sign(_handle, asSlice(message), signature); });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<HybridAddressSpec>>> HybridPrivateKey::toAddress() {
+  return CryptoExecutor::shared().run<std::shared_ptr<HybridAddressSpec>>(
+      CryptoExecutor::Priority::Interactive, nullptr, [self = self()]() -> std::shared_ptr<HybridAddressSpec> { return self->deriveAddress(); });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<HybridViewKeySpec>>> HybridPrivateKey::toViewKey() {
+  return CryptoExecutor::shared().run<std::shared_ptr<HybridViewKeySpec>>(
+      CryptoExecutor::Priority::Interactive, nullptr, [self = self()]() -> std::shared_ptr<HybridViewKeySpec> { return self->deriveViewKey(); });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+HybridPrivateKey::sign(const std::shared_ptr<ArrayBuffer>& message, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  return CryptoExecutor::shared().run<std::shared_ptr<ArrayBuffer>>(
+      CryptoExecutor::Priority::Interactive, token.value_or(nullptr),
+      [self = self(), message = retainForAsync(message)]() -> std::shared_ptr<ArrayBuffer> { return self->signBytes(message); });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+HybridPrivateKey::signFields(const std::shared_ptr<ArrayBuffer>& fields, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  return CryptoExecutor::shared().run<std::shared_ptr<ArrayBuffer>>(
+      CryptoExecutor::Priority::Interactive, token.value_or(nullptr),
+      [self = self(), fields = retainForAsync(fields)]() -> std::shared_ptr<ArrayBuffer> {
+        return signInto([&](rust::Slice<uint8_t> signature) { return private_key_sign_fields(self->_handle, asSlice(fields), signature); });
+      });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+HybridPrivateKey::signEncoded(const std::shared_ptr<HybridEncodedMessageSpec>& message,
+                              const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  // The message object is kept alive, its fields are signed in place without a copy
+  return CryptoExecutor::shared().run<std::shared_ptr<ArrayBuffer>>(
+      CryptoExecutor::Priority::Interactive, token.value_or(nullptr),
+      [self = self(), message = HybridEncodedMessage::from(message)]() -> std::shared_ptr<ArrayBuffer> {
+        return signInto(
+            [&](rust::Slice<uint8_t> signature) { return private_key_sign_encoded(self->_handle, message->handle(), signature); });
+      });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+HybridPrivateKey::signBatch(const std::vector<std::shared_ptr<ArrayBuffer>>& messages,
+                            const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  // Pack messages into one buffer for the async operation (non-owning buffers)
+  size_t totalSize = 0;
+  for (const auto& message : messages) {
+    totalSize += message->size();
+  }
+  std::vector<uint8_t> packed;
+  std::vector<uint32_t> lengths;
+  {
+    MarshalTimer timer(totalSize);
+    packed.reserve(totalSize);
+    lengths.reserve(messages.size());
+    for (const auto& message : messages) {
+      packed.insert(packed.end(), message->data(), message->data() + message->size());
+      lengths.push_back(static_cast<uint32_t>(message->size()));
+    }
+  }
+
+  return CryptoExecutor::shared().run<std::shared_ptr<ArrayBuffer>>(
+      CryptoExecutor::Priority::Background, token.value_or(nullptr),
+      [self = self(), packed = std::move(packed), lengths = std::move(lengths)]() -> std::shared_ptr<ArrayBuffer> {
+        auto signatures = ArrayBuffer::allocate(signature_batch_size(lengths.size()));
+        auto result = private_key_sign_batch(self->_handle, rust::Slice<const uint8_t>(packed.data(), packed.size()),
+                                             rust::Slice<const uint32_t>(lengths.data(), lengths.size()), asMutableSlice(signatures));
+        if (!result.success) {
+          throw std::runtime_error(std::string(result.error));
+        }
+        return signatures;
+      });
+}
+
+std::shared_ptr<HybridStreamingSignerSpec> HybridPrivateKey::createSigner() {
+  return std::make_shared<HybridStreamingSigner>(self());
+}
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "HybridPrivateKeySpec.hpp"
+#include "rust/lib.rs.h"
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::provable {
+
+class HybridAddress;
+class HybridViewKey;
+
+class HybridPrivateKey : public HybridPrivateKeySpec {
+ public:
+  explicit HybridPrivateKey(PrivateKeyHandle handle) : HybridObject(TAG), _handle(handle) {}
+  ~HybridPrivateKey() override;
+
+  std::string toString() override;
+  std::shared_ptr<Promise<std::shared_ptr<HybridAddressSpec>>> toAddress() override;
+  std::shared_ptr<Promise<std::shared_ptr<HybridViewKeySpec>>> toViewKey() override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+  sign(const std::shared_ptr<ArrayBuffer>& message, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+  signFields(const std::shared_ptr<ArrayBuffer>& fields, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+  signEncoded(const std::shared_ptr<HybridEncodedMessageSpec>& message,
+              const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+  signBatch(const std::vector<std::shared_ptr<ArrayBuffer>>& messages,
+            const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+  std::shared_ptr<HybridStreamingSignerSpec> createSigner() override;
+  std::shared_ptr<ArrayBuffer> toBytes() override;
+
+  const PrivateKeyHandle& handle() const {
+    return _handle;
+  }
+  std::shared_ptr<HybridAddress> deriveAddress() const;
+  std::shared_ptr<HybridViewKey> deriveViewKey() const;
+
+ private:
+  std::shared_ptr<HybridPrivateKey> self() {
+    return std::dynamic_pointer_cast<HybridPrivateKey>(shared_from_this());
+  }
+  std::shared_ptr<ArrayBuffer> signBytes(const std::shared_ptr<ArrayBuffer>& message) const;
+
+  PrivateKeyHandle _handle;
+};
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,21 @@
+#include "HybridStreamingSigner.hpp"
+#include "HybridPrivateKey.hpp"
+
+namespace margelo::nitro::provable {
+
+std::shared_ptr<Promise<void>> HybridStreamingSigner::update(const std::shared_ptr<ArrayBuffer>& chunk) {
+  return _stream->update(chunk);
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> HybridStreamingSigner::finalize() {
+  return _stream->finalize<std::shared_ptr<ArrayBuffer>>([privateKey = _privateKey](const StreamHandle& stream) -> std::shared_ptr<ArrayBuffer> {
+    auto signature = ArrayBuffer::allocate(signature_size_in_bytes());
+    auto result = stream_sign(stream, privateKey->handle(), asMutableSlice(signature));
+    if (!result.success) {
+      throw std::runtime_error(std::string(result.error));
+    }
+    return signature;
+  });
+}
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "HybridStreamingSignerSpec.hpp"
+#include "StreamState.hpp"
+
+namespace margelo::nitro::provable {
+
+class HybridPrivateKey;
+
+class HybridStreamingSigner : public HybridStreamingSignerSpec {
+ public:
+  explicit HybridStreamingSigner(std::shared_ptr<HybridPrivateKey> privateKey)
+      : HybridObject(TAG), _privateKey(std::move(privateKey)), _stream(std::make_shared<StreamState>()) {}
+
+  std::shared_ptr<Promise<void>> update(const std::shared_ptr<ArrayBuffer>& chunk) override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> finalize() override;
+
+ private:
+  std::shared_ptr<HybridPrivateKey> _privateKey;
+  std::shared_ptr<StreamState> _stream;
+};
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,16 @@
+#include "HybridStreamingVerifier.hpp"
+#include "HybridAddress.hpp"
+
+namespace margelo::nitro::provable {
+
+std::shared_ptr<Promise<void>> HybridStreamingVerifier::update(const std::shared_ptr<ArrayBuffer>& chunk) {
+  return _stream->update(chunk);
+}
+
+std::shared_ptr<Promise<bool>> HybridStreamingVerifier::finalize(const std::shared_ptr<ArrayBuffer>& signature) {
+  return _stream->finalize<bool>([address = _address, signature = retainForAsync(signature)](const StreamHandle& stream) -> bool {
+    return stream_verify(stream, address->handle(), asSlice(signature));
+  });
+}
+
+} // namespace margelo::nitro::provable
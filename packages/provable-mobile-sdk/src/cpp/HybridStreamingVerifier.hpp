@@ -0,0 +1,23 @@
+#pragma once
+
+#include "HybridStreamingVerifierSpec.hpp"
+#include "StreamState.hpp"
+
+namespace margelo::nitro::provable {
+
+class HybridAddress;
+
+class HybridStreamingVerifier : public HybridStreamingVerifierSpec {
+ public:
+  explicit HybridStreamingVerifier(std::shared_ptr<HybridAddress> address)
+      : HybridObject(TAG), _address(std::move(address)), _stream(std::make_shared<StreamState>()) {}
+
+  std::shared_ptr<Promise<void>> update(const std::shared_ptr<ArrayBuffer>& chunk) override;
+  std::shared_ptr<Promise<bool>> finalize(const std::shared_ptr<ArrayBuffer>& signature) override;
+
+ private:
+  std::shared_ptr<HybridAddress> _address;
+  std::shared_ptr<StreamState> _stream;
+};
+
+} // namespace margelo::nitro::provable
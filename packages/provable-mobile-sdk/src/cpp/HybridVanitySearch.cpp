@@ -0,0 +1,45 @@
+#include "HybridVanitySearch.hpp"
+#include "HybridPrivateKey.hpp"
+#include <thread>
+
+namespace margelo::nitro::provable {
+
+HybridVanitySearch::HybridVanitySearch(VanitySearchHandle handle)
+    : HybridObject(TAG), _handle(handle), _result(Promise<std::shared_ptr<HybridPrivateKeySpec>>::create()) {}
+
+HybridVanitySearch::~HybridVanitySearch() {
+  vanity_search_cancel(_handle);
+  destroy_vanity_search(_handle);
+}
+
+double HybridVanitySearch::getAttempts() {
+  return static_cast<double>(vanity_search_progress(_handle).attempts);
+}
+
+double HybridVanitySearch::getAttemptsPerSecond() {
+  auto progress = vanity_search_progress(_handle);
+  return progress.elapsed_seconds > 0 ? static_cast<double>(progress.attempts) / progress.elapsed_seconds : 0;
+}
+
+std::shared_ptr<Promise<std::shared_ptr<HybridPrivateKeySpec>>> HybridVanitySearch::result() {
+  return _result;
+}
+
+void HybridVanitySearch::cancel() {
+  vanity_search_cancel(_handle);
+}
+
+void HybridVanitySearch::start(size_t threads) {
+  // The thread only holds the handle, so dropping this object cancels the search instead of leaking it.
+  // The Rust side keeps the search state alive until the run returns.
+  std::thread([handle = _handle, result = _result, threads]() {
+    auto keyHandle = vanity_search_run(handle, threads);
+    if (keyHandle.id == 0) {
+      result->reject(std::make_exception_ptr(std::runtime_error("Vanity search was cancelled")));
+      return;
+    }
+    result->resolve(std::make_shared<HybridPrivateKey>(keyHandle));
+  }).detach();
+}
+
+} // namespace margelo::nitro::provable
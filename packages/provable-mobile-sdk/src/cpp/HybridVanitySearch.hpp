@@ -0,0 +1,28 @@
+#pragma once
+
+#include "HybridVanitySearchSpec.hpp"
+#include "rust/lib.rs.h"
+
+namespace margelo::nitro::provable {
+
+// A running vanity address search. The search runs on its own threads until it finds a match or is cancelled,
+// dropping the object cancels it as well.
+class HybridVanitySearch : public HybridVanitySearchSpec {
+ public:
+  explicit HybridVanitySearch(VanitySearchHandle handle);
+  ~HybridVanitySearch() override;
+
+  double getAttempts() override;
+  double getAttemptsPerSecond() override;
+
+  std::shared_ptr<Promise<std::shared_ptr<HybridPrivateKeySpec>>> result() override;
+  void cancel() override;
+
+  void start(size_t threads);
+
+ private:
+  VanitySearchHandle _handle;
+  std::shared_ptr<Promise<std::shared_ptr<HybridPrivateKeySpec>>> _result;
+};
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,52 @@
+#include "HybridViewKey.hpp"
+#include "ArrayBufferUtils.hpp"
+#include "CryptoExecutor.hpp"
+#include "HybridAddress.hpp"
+#include "SecretArena.hpp"
+
+namespace margelo::nitro::provable {
+
+HybridViewKey::~HybridViewKey() {
+  destroy_view_key(_handle);
+}
+
+std::string HybridViewKey::toString() {
+  auto buffer = SecretArena::shared().lease();
+  auto length = view_key_write_string(_handle, buffer.slice());
+  if (length == 0) {
+    throw std::runtime_error("Invalid view key handle");
+  }
+  return std::string(buffer.chars(), length);
+}
+
+std::shared_ptr<ArrayBuffer> HybridViewKey::toBytes() {
+  return writeToArrayBuffer(view_key_size_in_bytes(), [this](rust::Slice<uint8_t> bytes) { return view_key_to_bytes(_handle, bytes); });
+}
+
+std::shared_ptr<HybridAddress> HybridViewKey::deriveAddress() const {
+  auto addrHandle = view_key_to_address(_handle);
+  if (addrHandle.id == 0) {
+    throw std::runtime_error("Invalid view key handle");
+  }
+  return std::make_shared<HybridAddress>(addrHandle);
+}
+
+std::shared_ptr<Promise<std::shared_ptr<HybridAddressSpec>>> HybridViewKey::toAddress() {
+  return CryptoExecutor::shared().run<std::shared_ptr<HybridAddressSpec>>(
+      CryptoExecutor::Priority::Interactive, nullptr, [self = self()]() -> std::shared_ptr<HybridAddressSpec> { return self->deriveAddress(); });
+}
+
+std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+HybridViewKey::scanRecords(const std::shared_ptr<ArrayBuffer>& records, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) {
+  return CryptoExecutor::shared().run<std::shared_ptr<ArrayBuffer>>(
+      CryptoExecutor::Priority::Background, token.value_or(nullptr),
+      [self = self(), records = retainForAsync(records)]() -> std::shared_ptr<ArrayBuffer> {
+        auto result = view_key_scan_records(self->_handle, asSlice(records));
+        if (!result.success) {
+          throw std::invalid_argument(std::string(result.error));
+        }
+        return toArrayBuffer(result.bytes);
+      });
+}
+
+} // namespace margelo::nitro::provable
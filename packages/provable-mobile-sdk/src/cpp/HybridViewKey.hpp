@@ -0,0 +1,31 @@
+#pragma once
+
+#include "HybridViewKeySpec.hpp"
+#include "rust/lib.rs.h"
+
+namespace margelo::nitro::provable {
+
+class HybridAddress;
+
+class HybridViewKey : public HybridViewKeySpec {
+ public:
+  explicit HybridViewKey(ViewKeyHandle handle) : HybridObject(TAG), _handle(handle) {}
+  ~HybridViewKey() override;
+
+  std::string toString() override;
+  std::shared_ptr<Promise<std::shared_ptr<HybridAddressSpec>>> toAddress() override;
+  std::shared_ptr<ArrayBuffer> toBytes() override;
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>>
+  scanRecords(const std::shared_ptr<ArrayBuffer>& records, const std::optional<std::shared_ptr<HybridCancellationTokenSpec>>& token) override;
+
+  std::shared_ptr<HybridAddress> deriveAddress() const;
+
+ private:
+  std::shared_ptr<HybridViewKey> self() {
+    return std::dynamic_pointer_cast<HybridViewKey>(shared_from_this());
+  }
+
+  ViewKeyHandle _handle;
+};
+
+} // namespace margelo::nitro::provable
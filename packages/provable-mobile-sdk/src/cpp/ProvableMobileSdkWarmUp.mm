@@ -0,0 +1,17 @@
+#import <Foundation/Foundation.h>
+
+#include "HybridAccount.hpp"
+
+// The iOS counterpart of the warm-up started from JNI_OnLoad in android/src/main/cpp/cpp-adapter.cpp
+@interface ProvableMobileSdkWarmUp : NSObject
+@end
+
+@implementation ProvableMobileSdkWarmUp
+
++ (void)load {
+#ifndef PROVABLE_MOBILE_SDK_NO_WARM_UP
+  margelo::nitro::provable::HybridAccount::startWarmUp();
+#endif
+}
+
+@end
@@ -0,0 +1,70 @@
+#include "SecretArena.hpp"
+#include <bit>
+#include <sys/mman.h>
+
+static_assert(margelo::nitro::provable::SecretArena::kSlotCount == 64, "Slots are tracked in one 64-bit mask");
+
+namespace margelo::nitro::provable {
+
+void secureWipe(void* data, size_t size) {
+  auto* bytes = static_cast<volatile uint8_t*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    bytes[i] = 0;
+  }
+}
+
+SecretArena& SecretArena::shared() {
+  // Intentionally leaked so buffers released during static destruction still have an arena to return to
+  static auto* arena = new SecretArena();
+  return *arena;
+}
+
+SecretArena::SecretArena() {
+  size_t size = kSlotSize * kSlotCount;
+  void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED) {
+    // Every lease falls back to the heap
+    _inUse = ~uint64_t(0);
+    return;
+  }
+  _memory = static_cast<uint8_t*>(memory);
+  // Best effort, locking fails once the process reaches its locked memory limit
+  _locked = mlock(memory, size) == 0;
+#ifdef MADV_DONTDUMP
+  madvise(memory, size, MADV_DONTDUMP);
+#endif
+}
+
+SecretArena::Buffer SecretArena::lease() {
+  uint64_t used = _inUse.load(std::memory_order_relaxed);
+  while (true) {
+    auto slot = static_cast<size_t>(std::countr_one(used));
+    if (slot == kSlotCount) {
+      return Buffer(this, new uint8_t[kSlotSize](), kSlotCount);
+    }
+    if (_inUse.compare_exchange_weak(used, used | (uint64_t(1) << slot), std::memory_order_acquire, std::memory_order_relaxed)) {
+      return Buffer(this, _memory + slot * kSlotSize, slot);
+    }
+  }
+}
+
+void SecretArena::release(Buffer& buffer) {
+  secureWipe(buffer._data, kSlotSize);
+  if (buffer._slot == kSlotCount) {
+    delete[] buffer._data;
+  } else {
+    _inUse.fetch_and(~(uint64_t(1) << buffer._slot), std::memory_order_release);
+  }
+}
+
+SecretArena::Buffer::Buffer(Buffer&& other) noexcept : _arena(other._arena), _data(other._data), _slot(other._slot) {
+  other._data = nullptr;
+}
+
+SecretArena::Buffer::~Buffer() {
+  if (_data != nullptr) {
+    _arena->release(*this);
+  }
+}
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "rust/lib.rs.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace margelo::nitro::provable {
+
+// Fixed pool of buffers for secret strings on their way between JS and Rust, so formatting a key doesn't leave
+// unwiped copies on the heap. The pool is one anonymous mapping, locked into memory and kept out of core dumps where
+// the platform allows. Buffers are wiped when released, and leasing one while every slot is taken falls back to the
+// heap (wiped the same way) instead of blocking.
+class SecretArena {
+ public:
+  static constexpr size_t kSlotSize = 128;
+  static constexpr size_t kSlotCount = 64;
+
+  class Buffer {
+   public:
+    Buffer(Buffer&& other) noexcept;
+    Buffer& operator=(Buffer&&) = delete;
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+    ~Buffer();
+
+    uint8_t* data() const {
+      return _data;
+    }
+    const char* chars() const {
+      return reinterpret_cast<const char*>(_data);
+    }
+    rust::Slice<uint8_t> slice() const {
+      return rust::Slice<uint8_t>(_data, kSlotSize);
+    }
+
+   private:
+    friend class SecretArena;
+    Buffer(SecretArena* arena, uint8_t* data, size_t slot) : _arena(arena), _data(data), _slot(slot) {}
+
+    SecretArena* _arena;
+    uint8_t* _data;
+    // `kSlotCount` for a heap buffer
+    size_t _slot;
+  };
+
+  static SecretArena& shared();
+
+  Buffer lease();
+  bool locked() const {
+    return _locked;
+  }
+
+ private:
+  SecretArena();
+  void release(Buffer& buffer);
+
+  uint8_t* _memory = nullptr;
+  std::atomic<uint64_t> _inUse{0};
+  bool _locked = false;
+};
+
+// Zeroes `size` bytes in a way the compiler can't drop as a dead store
+void secureWipe(void* data, size_t size);
+
+} // namespace margelo::nitro::provable
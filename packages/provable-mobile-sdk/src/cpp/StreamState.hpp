@@ -0,0 +1,68 @@
+#pragma once
+
+#include "ArrayBufferUtils.hpp"
+#include "CryptoExecutor.hpp"
+#include "rust/lib.rs.h"
+#include <atomic>
+#include <stdexcept>
+
+namespace margelo::nitro::provable {
+
+// Owns a Rust stream hasher shared by the streaming signer and verifier.
+// Only one operation may touch the stream at a time, callers have to await each update before the next one, which
+// keeps chunks in order and bounds the memory held by in-flight chunks to one chunk.
+class StreamState : public std::enable_shared_from_this<StreamState> {
+ public:
+  StreamState() : _handle(stream_new()) {}
+  ~StreamState() {
+    destroy_stream(_handle);
+  }
+
+  // Chunks can be megabytes, so they are hashed on the background lane and never hold up the interactive worker
+  std::shared_ptr<Promise<void>> update(const std::shared_ptr<ArrayBuffer>& chunk) {
+    acquire();
+    auto promise = CryptoExecutor::shared().run<void>(CryptoExecutor::Priority::Background, nullptr,
+                                                      [self = shared_from_this(), chunk = retainForAsync(chunk)]() {
+                                                        Busy busy(*self);
+                                                        auto result = stream_update(self->_handle, asSlice(chunk));
+                                                        if (!result.success) {
+                                                          throw std::runtime_error(std::string(result.error));
+                                                        }
+                                                      });
+    // A full background queue rejects the update without running it, so nothing else would release the stream
+    if (!promise->isPending()) {
+      _busy = false;
+    }
+    return promise;
+  }
+
+  // Runs `job` with the stream handle once pending updates are done, the stream is finalized afterwards
+  template <typename T>
+  std::shared_ptr<Promise<T>> finalize(std::function<T(const StreamHandle&)> job) {
+    acquire();
+    return CryptoExecutor::shared().run<T>(CryptoExecutor::Priority::Interactive, nullptr, [self = shared_from_this(), job = std::move(job)]() {
+      Busy busy(*self);
+      return job(self->_handle);
+    });
+  }
+
+ private:
+  struct Busy {
+    explicit Busy(StreamState& state) : state(state) {}
+    ~Busy() {
+      state._busy = false;
+    }
+    StreamState& state;
+  };
+
+  void acquire() {
+    if (_busy.exchange(true)) {
+      throw std::logic_error("Await the previous update before calling update or finalize again");
+    }
+  }
+
+  StreamHandle _handle;
+  std::atomic<bool> _busy{false};
+};
+
+} // namespace margelo::nitro::provable
@@ -0,0 +1,276 @@
+use std::collections::HashMap;
+use std::sync::Arc;
+
+use rayon::prelude::*;
+use snarkvm_console::{
+    account::{Address, ComputeKey, PrivateKey, Signature},
+    network::Network,
+    prelude::{FromBytes, ToBytes, Zero},
+    types::Field,
+};
+
+use crate::schnorr::{message_to_fields, owns_address, secret_to_fields, verify_challenge};
+use crate::secure::SecretString;
+use crate::stats::{self, Operation};
+use crate::{
+    address_cache, bytes_error_result, bytes_success_result, ensure_private_key_storage, error_result, ffi, sign_into,
+    sign_status_message, signature_size_in_bytes, signing_context, success_result, CurrentNetwork,
+};
+
+/// Reads byte strings packed as `u32 count | u32 offsets[count + 1] | bytes`,
+/// with little-endian offsets measured from the start of the buffer, so entry
+/// `i` spans `offsets[i]..offsets[i + 1]`.
+pub(crate) fn unpack_with_offsets(packed: &[u8]) -> Option<Vec<&[u8]>> {
+    let read_u32 = |index: usize| -> Option<usize> {
+        let bytes = packed.get(index * 4..index * 4 + 4)?;
+        Some(u32::from_le_bytes(bytes.try_into().ok()?) as usize)
+    };
+    // The count is untrusted: its offsets table must fit in the buffer
+    let count = read_u32(0)?;
+    let table_end = count.checked_add(2).filter(|&end| end <= packed.len() / 4)?;
+    let offsets = (1..table_end).map(read_u32).collect::<Option<Vec<_>>>()?;
+    offsets.windows(2).map(|range| packed.get(range[0]..range[1])).collect()
+}
+
+/// Packs byte strings into the layout read by `unpack_with_offsets`, or
+/// returns `None` when the packed size would not fit the u32 offsets.
+pub(crate) fn pack_with_offsets<T: AsRef<[u8]>>(entries: &[T]) -> Option<Vec<u8>> {
+    let header = entries.len().checked_add(2)?.checked_mul(4)?;
+    let size = entries.iter().try_fold(header, |size, entry| size.checked_add(entry.as_ref().len()))?;
+    if size > u32::MAX as usize {
+        return None;
+    }
+    let mut packed = Vec::with_capacity(size);
+    packed.extend_from_slice(&(entries.len() as u32).to_le_bytes());
+    let mut offset = header;
+    packed.extend_from_slice(&(offset as u32).to_le_bytes());
+    for entry in entries {
+        offset += entry.as_ref().len();
+        packed.extend_from_slice(&(offset as u32).to_le_bytes());
+    }
+    for entry in entries {
+        packed.extend_from_slice(entry.as_ref());
+    }
+    Some(packed)
+}
+
+/// Splits `messages` into consecutive slices of the given lengths.
+pub(crate) fn split_by_lengths<'a>(messages: &'a [u8], lengths: &[u32]) -> Option<Vec<&'a [u8]>> {
+    let mut rest = messages;
+    let mut parts = Vec::with_capacity(lengths.len());
+    for &len in lengths {
+        if rest.len() < len as usize {
+            return None;
+        }
+        let (part, tail) = rest.split_at(len as usize);
+        parts.push(part);
+        rest = tail;
+    }
+    rest.is_empty().then_some(parts)
+}
+
+/// Size of the packed `private_key_sign_batch` output for `count` messages,
+/// or `usize::MAX` when its offsets would not fit in 32 bits.
+pub fn signature_batch_size(count: usize) -> usize {
+    packed_signatures_size(count).unwrap_or(usize::MAX)
+}
+
+fn packed_signatures_size(count: usize) -> Option<usize> {
+    let size = count.checked_add(2)?.checked_mul(4)?.checked_add(count.checked_mul(signature_size_in_bytes())?)?;
+    (size <= u32::MAX as usize).then_some(size)
+}
+
+pub fn private_key_sign_batch(
+    handle: &ffi::PrivateKeyHandle,
+    messages: &[u8],
+    lengths: &[u32],
+    signatures: &mut [u8],
+) -> ffi::AccountResult {
+    let Some(key) = ensure_private_key_storage().get(handle.id) else {
+        return error_result("Invalid private key handle".to_string());
+    };
+    let Some(messages) = split_by_lengths(messages, lengths) else {
+        return error_result("Message lengths do not match the packed message buffer".to_string());
+    };
+    if packed_signatures_size(messages.len()) != Some(signatures.len()) {
+        return error_result("Signature buffer has the wrong size".to_string());
+    }
+
+    // Write the offsets table, then sign every message straight into its slot
+    let size = signature_size_in_bytes();
+    let header_size = 4 * (messages.len() + 2);
+    let (header, body) = signatures.split_at_mut(header_size);
+    header[..4].copy_from_slice(&(messages.len() as u32).to_le_bytes());
+    for (i, offset) in header[4..].chunks_exact_mut(4).enumerate() {
+        offset.copy_from_slice(&((header_size + i * size) as u32).to_le_bytes());
+    }
+
+    let result = stats::timed(Operation::Batch, || {
+        body.par_chunks_mut(size).zip(messages.par_iter()).try_for_each(|(out, message)| match sign_into(&key, message, out, false) {
+            ffi::SignStatus::Ok => Ok(()),
+            status => Err(status),
+        })
+    });
+
+    match result {
+        Ok(()) => success_result(String::new()),
+        Err(status) => error_result(sign_status_message(status).to_string()),
+    }
+}
+
+/// Verifies packed `(address, signature, message)` triples and returns a
+/// bitmap with bit `i` (LSB first) set when triple `i` is valid.
+///
+/// Addresses are decoded once per distinct string and each signer's compute
+/// key is checked against its address once, so a feed of many signatures
+/// from the same counterparty only pays for the challenge check per entry.
+pub fn address_verify_batch(triples: &[u8]) -> ffi::BytesResult {
+    stats::timed(Operation::Batch, || verify_triples(triples))
+}
+
+fn verify_triples(triples: &[u8]) -> ffi::BytesResult {
+    let Some(entries) = unpack_with_offsets(triples).filter(|entries| entries.len() % 3 == 0) else {
+        return bytes_error_result("Malformed verification batch".to_string());
+    };
+    let triples: Vec<&[&[u8]]> = entries.chunks(3).collect();
+
+    let mut address_index = HashMap::new();
+    let mut distinct_addresses = Vec::new();
+    let triple_addresses: Vec<usize> = triples
+        .iter()
+        .map(|triple| {
+            *address_index.entry(triple[0]).or_insert_with(|| {
+                distinct_addresses.push(triple[0]);
+                distinct_addresses.len() - 1
+            })
+        })
+        .collect();
+
+    let addresses: Vec<Option<Arc<Address<CurrentNetwork>>>> = distinct_addresses
+        .par_iter()
+        .map(|address| address_cache().get_or_parse(std::str::from_utf8(address).ok()?))
+        .collect();
+    let signatures: Vec<Option<Signature<CurrentNetwork>>> =
+        triples.par_iter().map(|triple| Signature::from_bytes_le(triple[1]).ok()).collect();
+
+    // Dedupe signers per address by their serialized compute key, so a feed of many distinct forged keys stays linear
+    let compute_keys: Vec<Option<Vec<u8>>> =
+        signatures.par_iter().map(|signature| signature.as_ref()?.compute_key().to_bytes_le().ok()).collect();
+    let mut signers: Vec<HashMap<&[u8], ComputeKey<CurrentNetwork>>> = vec![HashMap::new(); addresses.len()];
+    for ((signature, compute_key), &address) in signatures.iter().zip(&compute_keys).zip(&triple_addresses) {
+        if let (Some(signature), Some(compute_key)) = (signature, compute_key) {
+            signers[address].entry(compute_key.as_slice()).or_insert_with(|| signature.compute_key());
+        }
+    }
+    let owners: Vec<HashMap<&[u8], bool>> = signers
+        .into_par_iter()
+        .zip(&addresses)
+        .map(|(compute_keys, address)| {
+            compute_keys
+                .into_iter()
+                .map(|(bytes, compute_key)| {
+                    let owned = address.as_ref().is_some_and(|address| owns_address(signing_context(), &compute_key, address));
+                    (bytes, owned)
+                })
+                .collect()
+        })
+        .collect();
+
+    let verify = |i: usize| -> bool {
+        let address = &addresses[triple_addresses[i]];
+        let (Some(address), Some(signature), Some(compute_key)) = (address, &signatures[i], &compute_keys[i]) else {
+            return false;
+        };
+        let owned = owners[triple_addresses[i]].get(compute_key.as_slice()) == Some(&true);
+        owned
+            && message_to_fields(triples[i][2]).is_some_and(|message| verify_challenge(signing_context(), signature, address, &message))
+    };
+
+    let chunk_size = triples.len().div_ceil(rayon::current_num_threads()).max(1);
+    let indices: Vec<usize> = (0..triples.len()).collect();
+    let results: Vec<bool> = indices.par_chunks(chunk_size).flat_map_iter(|chunk| chunk.iter().map(|&i| verify(i))).collect();
+
+    bytes_success_result(to_bitmap(&results))
+}
+
+/// Packs `flags` into a bitmap with bit `i` (LSB first) set when `flags[i]` is true.
+pub(crate) fn to_bitmap(flags: &[bool]) -> Vec<u8> {
+    let mut bitmap = vec![0u8; flags.len().div_ceil(8)];
+    for (i, &flag) in flags.iter().enumerate() {
+        if flag {
+            bitmap[i / 8] |= 1 << (i % 8);
+        }
+    }
+    bitmap
+}
+
+pub const ACCOUNT_SEED_SIZE: usize = 32;
+
+// Bounds the memory and the background worker time a single call can claim
+pub const MAX_DERIVED_ACCOUNTS: u32 = 4096;
+
+/// Derives the accounts at indices `start_index..start_index + count` of `seed`
+/// and packs their private key, view key and address strings as consecutive
+/// entries in the offsets layout, so account `i` spans entries `3i..3i + 3`.
+///
+/// Account `i`'s private key seed is the Poseidon hash of a domain separator,
+/// the seed bits and the index, so the same seed always yields the same range.
+/// The result holds key strings, so callers wipe it once they have copied it.
+pub fn derive_accounts(seed: &[u8], start_index: u32, count: u32) -> ffi::BytesResult {
+    stats::timed(Operation::Batch, || derive_range(seed, start_index, count))
+}
+
+fn derive_range(seed: &[u8], start_index: u32, count: u32) -> ffi::BytesResult {
+    if seed.len() != ACCOUNT_SEED_SIZE {
+        return bytes_error_result(format!("The seed must be {} bytes", ACCOUNT_SEED_SIZE));
+    }
+    if start_index.checked_add(count).is_none() {
+        return bytes_error_result("The account index range overflows".to_string());
+    }
+    if count > MAX_DERIVED_ACCOUNTS {
+        return bytes_error_result(format!("At most {} accounts can be derived per call", MAX_DERIVED_ACCOUNTS));
+    }
+
+    // The seed packs into two fields, they are copied into the stack preimage and the heap copy is wiped
+    let Some(mut seed) = secret_to_fields::<CurrentNetwork>(seed) else {
+        return bytes_error_result("Failed to encode the seed as field elements".to_string());
+    };
+    let [low, high] = seed[..] else {
+        return bytes_error_result("Failed to encode the seed as field elements".to_string());
+    };
+    for field in seed.iter_mut() {
+        unsafe { std::ptr::write_volatile(field, Field::zero()) };
+    }
+    let preimage = [Field::<CurrentNetwork>::new_domain_separator("ProvableMobileSdkAccount"), low, high, Field::zero()];
+    let context = signing_context();
+
+    // Key strings are formatted into wiped secret buffers, the packed result is the only other copy
+    let accounts: Result<Vec<(SecretString, SecretString, String)>, String> = (start_index..start_index + count)
+        .into_par_iter()
+        .map(|index| {
+            let mut input = preimage;
+            input[3] = Field::from_u64(index as u64);
+            let key_seed = CurrentNetwork::hash_psd2(&input).map_err(|e| e.to_string())?;
+            let private_key = PrivateKey::<CurrentNetwork>::try_from(key_seed).map_err(|e| e.to_string())?;
+            let view_key = context.view_key(&private_key).map_err(|e| e.to_string())?;
+            let address = context.view_key_to_address(&view_key);
+            let private_key = SecretString::private_key(&private_key).ok_or("Failed to format the private key")?;
+            let view_key = SecretString::view_key(&view_key).ok_or("Failed to format the view key")?;
+            Ok((private_key, view_key, address.to_string()))
+        })
+        .collect();
+
+    match accounts {
+        Ok(accounts) => {
+            let entries: Vec<&[u8]> = accounts
+                .iter()
+                .flat_map(|(private_key, view_key, address)| [private_key.as_ref(), view_key.as_ref(), address.as_bytes()])
+                .collect();
+            match pack_with_offsets(&entries) {
+                Some(packed) => bytes_success_result(packed),
+                None => bytes_error_result("The derived accounts do not fit in one result".to_string()),
+            }
+        }
+        Err(e) => bytes_error_result(format!("Account derivation failed: {}", e)),
+    }
+}
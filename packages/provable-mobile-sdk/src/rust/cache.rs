@@ -0,0 +1,222 @@
+use std::collections::hash_map::RandomState;
+use std::collections::HashMap;
+use std::hash::BuildHasher;
+use std::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
+use std::sync::{Arc, Mutex, RwLock};
+
+use snarkvm_console::{
+    account::{Address, PrivateKey, ViewKey},
+    prelude::{FromBytes, ToBytes},
+};
+use zeroize::{Zeroize, Zeroizing};
+
+use crate::{signing_context, CurrentNetwork};
+
+// A view key serializes to a single scalar
+const VIEW_KEY_SIZE: usize = 32;
+
+struct Entry {
+    address: Option<Arc<Address<CurrentNetwork>>>,
+    view_key: Option<Zeroizing<[u8; VIEW_KEY_SIZE]>>,
+    last_used: u64,
+}
+
+struct Entries {
+    tick: u64,
+    map: HashMap<u128, Entry>,
+}
+
+impl Entries {
+    fn touch(&mut self, key: u128, capacity: usize) -> &mut Entry {
+        self.tick += 1;
+        let tick = self.tick;
+        if !self.map.contains_key(&key) {
+            if self.map.len() >= capacity {
+                self.evict_oldest();
+            }
+            self.map.insert(key, Entry { address: None, view_key: None, last_used: tick });
+        }
+        let entry = self.map.get_mut(&key).unwrap();
+        entry.last_used = tick;
+        entry
+    }
+
+    // Linear scan - the cache holds a handful of wallet accounts, so this is
+    // cheaper than maintaining a linked list on every hit
+    fn evict_oldest(&mut self) {
+        if let Some(&oldest) = self.map.iter().min_by_key(|(_, entry)| entry.last_used).map(|(key, _)| key) {
+            self.map.remove(&oldest);
+        }
+    }
+}
+
+/// Size-bounded LRU memoizing the address and view key derived from a private key.
+///
+/// Entries are keyed by a 128-bit hash of the key's seed under per-process
+/// random keys, so the map never holds key material itself. Cached view keys
+/// are stored serialized and zeroized when their entry is evicted or cleared.
+/// The cache starts disabled; `set_capacity` with a non-zero size enables it.
+pub(crate) struct DerivationCache {
+    entries: Mutex<Entries>,
+    // Kept outside the lock so derivations skip the cache without locking while it is disabled
+    capacity: AtomicUsize,
+    hashers: (RandomState, RandomState),
+    hits: AtomicU64,
+    misses: AtomicU64,
+}
+
+impl DerivationCache {
+    pub(crate) fn new() -> Self {
+        Self {
+            entries: Mutex::new(Entries { tick: 0, map: HashMap::new() }),
+            capacity: AtomicUsize::new(0),
+            hashers: (RandomState::new(), RandomState::new()),
+            hits: AtomicU64::new(0),
+            misses: AtomicU64::new(0),
+        }
+    }
+
+    pub(crate) fn set_capacity(&self, capacity: usize) {
+        // Written under the lock so `store` sees the new capacity together with the evictions
+        let mut entries = self.entries.lock().unwrap();
+        self.capacity.store(capacity, Ordering::Relaxed);
+        while entries.map.len() > capacity {
+            entries.evict_oldest();
+        }
+    }
+
+    /// Returns `(hits, misses, size, capacity)`.
+    pub(crate) fn stats(&self) -> (u64, u64, usize, usize) {
+        let size = self.entries.lock().unwrap().map.len();
+        (self.hits.load(Ordering::Relaxed), self.misses.load(Ordering::Relaxed), size, self.capacity.load(Ordering::Relaxed))
+    }
+
+    pub(crate) fn address(&self, key: &PrivateKey<CurrentNetwork>) -> Option<Arc<Address<CurrentNetwork>>> {
+        let Some(cache_key) = self.cache_key(key) else {
+            return signing_context().address(key).ok().map(Arc::new);
+        };
+        if let Some(address) = self.lookup(cache_key, |entry| entry.address.clone()) {
+            return Some(address);
+        }
+
+        // Derive outside the lock so concurrent misses for different keys don't serialize
+        let address = Arc::new(signing_context().address(key).ok()?);
+        self.store(cache_key, |entry| entry.address = Some(address.clone()));
+        Some(address)
+    }
+
+    pub(crate) fn view_key(&self, key: &PrivateKey<CurrentNetwork>) -> Option<ViewKey<CurrentNetwork>> {
+        let Some(cache_key) = self.cache_key(key) else {
+            return signing_context().view_key(key).ok();
+        };
+        if let Some(bytes) = self.lookup(cache_key, |entry| entry.view_key.clone()) {
+            return ViewKey::from_bytes_le(&*bytes).ok();
+        }
+
+        let view_key = signing_context().view_key(key).ok()?;
+        let mut bytes = Zeroizing::new([0u8; VIEW_KEY_SIZE]);
+        if view_key.write_le(&mut bytes[..]).is_ok() {
+            self.store(cache_key, |entry| entry.view_key = Some(bytes));
+        }
+        Some(view_key)
+    }
+
+    // Returns `None` while the cache is disabled
+    fn cache_key(&self, key: &PrivateKey<CurrentNetwork>) -> Option<u128> {
+        if self.capacity.load(Ordering::Relaxed) == 0 {
+            return None;
+        }
+        let mut seed = key.seed().to_bytes_le().ok()?;
+        let hash = ((self.hashers.0.hash_one(&seed) as u128) << 64) | self.hashers.1.hash_one(&seed) as u128;
+        seed.zeroize();
+        Some(hash)
+    }
+
+    fn lookup<T>(&self, cache_key: u128, get: impl FnOnce(&Entry) -> Option<T>) -> Option<T> {
+        let mut entries = self.entries.lock().unwrap();
+        entries.tick += 1;
+        let tick = entries.tick;
+        let value = entries.map.get_mut(&cache_key).and_then(|entry| {
+            entry.last_used = tick;
+            get(entry)
+        });
+        let counter = if value.is_some() { &self.hits } else { &self.misses };
+        counter.fetch_add(1, Ordering::Relaxed);
+        value
+    }
+
+    fn store(&self, cache_key: u128, set: impl FnOnce(&mut Entry)) {
+        let mut entries = self.entries.lock().unwrap();
+        // The cache may have been disabled while we were deriving
+        let capacity = self.capacity.load(Ordering::Relaxed);
+        if capacity > 0 {
+            set(entries.touch(cache_key, capacity));
+        }
+    }
+}
+
+struct CachedAddress {
+    address: Arc<Address<CurrentNetwork>>,
+    last_used: AtomicU64,
+}
+
+struct Addresses {
+    capacity: usize,
+    map: HashMap<String, CachedAddress>,
+}
+
+/// Concurrent LRU of decoded addresses keyed by their bech32 string.
+///
+/// Decoding an address means a bech32 decode plus a point decompression and
+/// subgroup check, which dominates verifying a short message from a known
+/// counterparty. Hits only take the read lock and bump an atomic timestamp,
+/// so parallel verifiers don't contend on it.
+pub(crate) struct AddressCache {
+    addresses: RwLock<Addresses>,
+    tick: AtomicU64,
+}
+
+impl AddressCache {
+    pub(crate) fn new(capacity: usize) -> Self {
+        Self { addresses: RwLock::new(Addresses { capacity, map: HashMap::new() }), tick: AtomicU64::new(0) }
+    }
+
+    pub(crate) fn set_capacity(&self, capacity: usize) {
+        let mut addresses = self.addresses.write().unwrap();
+        addresses.capacity = capacity;
+        while addresses.map.len() > capacity {
+            Self::evict_oldest(&mut addresses);
+        }
+    }
+
+    /// Returns the decoded address, decoding and caching it on a miss.
+    pub(crate) fn get_or_parse(&self, address: &str) -> Option<Arc<Address<CurrentNetwork>>> {
+        if let Some(cached) = self.addresses.read().unwrap().map.get(address) {
+            cached.last_used.store(self.tick.fetch_add(1, Ordering::Relaxed), Ordering::Relaxed);
+            return Some(cached.address.clone());
+        }
+
+        let parsed = Arc::new(address.parse::<Address<CurrentNetwork>>().ok()?);
+        let mut addresses = self.addresses.write().unwrap();
+        if addresses.capacity == 0 {
+            return Some(parsed);
+        }
+        if !addresses.map.contains_key(address) && addresses.map.len() >= addresses.capacity {
+            Self::evict_oldest(&mut addresses);
+        }
+        let last_used = AtomicU64::new(self.tick.fetch_add(1, Ordering::Relaxed));
+        let cached = addresses.map.entry(address.to_string()).or_insert(CachedAddress { address: parsed, last_used });
+        Some(cached.address.clone())
+    }
+
+    fn evict_oldest(addresses: &mut Addresses) {
+        let oldest = addresses
+            .map
+            .iter()
+            .min_by_key(|(_, cached)| cached.last_used.load(Ordering::Relaxed))
+            .map(|(key, _)| key.clone());
+        if let Some(oldest) = oldest {
+            addresses.map.remove(&oldest);
+        }
+    }
+}
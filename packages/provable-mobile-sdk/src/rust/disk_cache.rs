@@ -0,0 +1,297 @@
+use std::collections::HashMap;
+use std::fs::{self, File, OpenOptions};
+use std::io::Write;
+use std::os::fd::AsRawFd;
+use std::os::unix::fs::OpenOptionsExt;
+use std::path::Path;
+
+use rayon::prelude::*;
+use snarkvm_console::{
+    account::{Address, PrivateKey, ViewKey},
+    network::Network,
+    prelude::{FromBits, FromBytes, ToBits, ToBytes, Uniform},
+    types::{Field, Group, Scalar},
+};
+
+use crate::secure::parse_private_key;
+use crate::{signing_context, CurrentNetwork};
+
+const MAGIC: &[u8; 8] = b"PMSACCT\0";
+// Version 1 fingerprinted the key string rather than its seed
+const VERSION: u32 = 2;
+// Magic, version and entry count
+const HEADER_SIZE: usize = 16;
+const FIELD_SIZE: usize = 32;
+// Fingerprint, nonce, the encrypted view key and address (x, y), and a MAC over all of them
+const ENTRY_FIELDS: usize = 6;
+const ENTRY_SIZE: usize = ENTRY_FIELDS * FIELD_SIZE;
+
+pub const CACHE_SECRET_SIZE: usize = 32;
+
+/// An account rebuilt by `restore_accounts`.
+pub(crate) struct RestoredAccount {
+    pub private_key: PrivateKey<CurrentNetwork>,
+    pub view_key: ViewKey<CurrentNetwork>,
+    pub address: Address<CurrentNetwork>,
+    // Whether the view key and address came from the cache rather than being derived
+    pub cached: bool,
+    fingerprint: Field<CurrentNetwork>,
+}
+
+// Domain-separated Poseidon keys derived from the caller's secret
+struct CacheKeys {
+    secret: Field<CurrentNetwork>,
+    fingerprint: Field<CurrentNetwork>,
+    keystream: Field<CurrentNetwork>,
+    mac: Field<CurrentNetwork>,
+}
+
+impl CacheKeys {
+    fn new(secret: &[u8]) -> Self {
+        Self {
+            secret: Field::from_bytes_le_mod_order(secret),
+            fingerprint: Field::new_domain_separator("ProvableMobileSdkCacheFingerprint"),
+            keystream: Field::new_domain_separator("ProvableMobileSdkCacheKeystream"),
+            mac: Field::new_domain_separator("ProvableMobileSdkCacheMac"),
+        }
+    }
+
+    // Identifies a private key's entry without revealing anything about the key to someone without the secret.
+    // Hashes the decoded seed, so the key's string or bits never pass through a reused buffer
+    fn fingerprint(&self, private_key: &PrivateKey<CurrentNetwork>) -> Option<Field<CurrentNetwork>> {
+        CurrentNetwork::hash_psd8(&[self.fingerprint, self.secret, private_key.seed()]).ok()
+    }
+
+    fn pad(&self, nonce: &Field<CurrentNetwork>) -> Vec<Field<CurrentNetwork>> {
+        CurrentNetwork::hash_many_psd8(&[self.keystream, self.secret, *nonce], 3)
+    }
+
+    fn tag(&self, fields: &[Field<CurrentNetwork>]) -> Option<Field<CurrentNetwork>> {
+        let mut input = vec![self.mac, self.secret];
+        input.extend_from_slice(fields);
+        CurrentNetwork::hash_psd8(&input).ok()
+    }
+}
+
+/// Rebuilds the accounts of `private_keys`, reading each one's view key and
+/// address from the cache file at `path` instead of deriving them.
+///
+/// The file is memory-mapped and entries are read in place. Each entry is
+/// encrypted and authenticated under `secret` with Poseidon, the same way
+/// Aleo records are, and an entry that is missing, fails its MAC or belongs to
+/// a different secret is derived instead. When anything had to be derived, or
+/// the file holds entries for keys no longer passed in, it is rewritten to
+/// match `private_keys` by writing a new file and renaming it over the old one.
+/// Failing to write the cache doesn't fail the restore.
+pub(crate) fn restore_accounts(path: &str, secret: &[u8], private_keys: &[&[u8]]) -> Result<Vec<RestoredAccount>, String> {
+    if secret.len() != CACHE_SECRET_SIZE {
+        return Err(format!("The cache secret must be {} bytes", CACHE_SECRET_SIZE));
+    }
+    let keys = CacheKeys::new(secret);
+    let mapped = MappedFile::open(path);
+    let entries = mapped.as_ref().map(|file| index_entries(file.bytes())).unwrap_or_default();
+
+    let accounts = private_keys
+        .par_iter()
+        .enumerate()
+        .map(|(i, string)| {
+            let invalid = || format!("Invalid private key at index {}", i);
+            let string = std::str::from_utf8(string).map_err(|_| invalid())?;
+            let private_key = parse_private_key::<CurrentNetwork>(string).ok_or_else(invalid)?;
+            let fingerprint = keys.fingerprint(&private_key).ok_or_else(invalid)?;
+            let fingerprint_bytes = fingerprint.to_bytes_le().map_err(|e| e.to_string())?;
+            if let Some((view_key, address)) = entries.get(fingerprint_bytes.as_slice()).and_then(|entry| decrypt_entry(&keys, entry)) {
+                return Ok(RestoredAccount { private_key, view_key, address, cached: true, fingerprint });
+            }
+            let view_key = signing_context().view_key(&private_key).map_err(|e| e.to_string())?;
+            let address = signing_context().view_key_to_address(&view_key);
+            Ok(RestoredAccount { private_key, view_key, address, cached: false, fingerprint })
+        })
+        .collect::<Result<Vec<_>, String>>()?;
+
+    let stale = accounts.iter().any(|account| !account.cached) || entries.len() != accounts.len();
+    drop(entries);
+    drop(mapped);
+    if stale {
+        // Best effort, the accounts are correct either way
+        let _ = write_entries(path, &keys, &accounts);
+    }
+    Ok(accounts)
+}
+
+// Maps each fingerprint to its entry. A file with the wrong magic, version or
+// length is treated as empty, so every account is derived and the file replaced
+fn index_entries(bytes: &[u8]) -> HashMap<&[u8], &[u8]> {
+    let Some((header, body)) = bytes.split_at_checked(HEADER_SIZE) else {
+        return HashMap::new();
+    };
+    let version = u32::from_le_bytes(header[8..12].try_into().unwrap());
+    let count = u32::from_le_bytes(header[12..16].try_into().unwrap()) as usize;
+    if &header[..8] != MAGIC || version != VERSION || body.len() != count * ENTRY_SIZE {
+        return HashMap::new();
+    }
+    body.chunks_exact(ENTRY_SIZE).map(|entry| (&entry[..FIELD_SIZE], entry)).collect()
+}
+
+fn decrypt_entry(keys: &CacheKeys, entry: &[u8]) -> Option<(ViewKey<CurrentNetwork>, Address<CurrentNetwork>)> {
+    let fields = entry.chunks_exact(FIELD_SIZE).map(|bytes| Field::from_bytes_le(bytes).ok()).collect::<Option<Vec<_>>>()?;
+    let (authenticated, tag) = fields.split_at(ENTRY_FIELDS - 1);
+    if keys.tag(authenticated)? != tag[0] {
+        return None;
+    }
+    let pad = keys.pad(&authenticated[1]);
+    let [view_key, x, y] = [0, 1, 2].map(|i| authenticated[2 + i] - pad[i]);
+    let view_key = ViewKey::from_scalar(Scalar::from_bits_le(&view_key.to_bits_le()).ok()?);
+    // Skipping the subgroup check is sound because entries are only written from addresses derived in this process, and
+    // a MAC that verifies means the coordinates are the ones written. Forging one takes the secret, and whoever has
+    // the secret can already write any valid address of their choosing, which the check wouldn't catch either
+    Some((view_key, Address::new(Group::from_xy_coordinates_unchecked(x, y))))
+}
+
+fn write_entries(path: &str, keys: &CacheKeys, accounts: &[RestoredAccount]) -> std::io::Result<()> {
+    let rng = &mut rand::thread_rng();
+    let mut bytes = Vec::with_capacity(HEADER_SIZE + accounts.len() * ENTRY_SIZE);
+    bytes.extend_from_slice(MAGIC);
+    bytes.extend_from_slice(&VERSION.to_le_bytes());
+    bytes.extend_from_slice(&(accounts.len() as u32).to_le_bytes());
+    for account in accounts {
+        let nonce = Field::rand(rng);
+        let pad = keys.pad(&nonce);
+        let view_key = Field::from_bits_le(&account.view_key.to_bits_le()).map_err(std::io::Error::other)?;
+        let plaintext = [view_key, account.address.to_x_coordinate(), account.address.to_y_coordinate()];
+        let mut fields = vec![account.fingerprint, nonce];
+        fields.extend((0..3).map(|i| plaintext[i] + pad[i]));
+        fields.push(keys.tag(&fields).ok_or_else(|| std::io::Error::other("Failed to authenticate a cache entry"))?);
+        for field in fields {
+            field.write_le(&mut bytes).map_err(std::io::Error::other)?;
+        }
+    }
+
+    let temporary = format!("{}.tmp", path);
+    let mut file = OpenOptions::new().write(true).create(true).truncate(true).mode(0o600).open(&temporary)?;
+    file.write_all(&bytes)?;
+    file.sync_all()?;
+    fs::rename(&temporary, path)?;
+    // The rename only survives a crash once the directory entry is on disk too
+    let directory = Path::new(path).parent().filter(|parent| !parent.as_os_str().is_empty()).unwrap_or(Path::new("."));
+    File::open(directory)?.sync_all()
+}
+
+// A read-only private mapping of a whole file. The cache is only ever replaced
+// by renaming a new file over it, so a mapped file is never truncated underneath us
+struct MappedFile {
+    ptr: *mut libc::c_void,
+    len: usize,
+}
+
+// The mapping is read-only, so it can be shared by the threads restoring accounts
+unsafe impl Send for MappedFile {}
+unsafe impl Sync for MappedFile {}
+
+impl MappedFile {
+    fn open(path: &str) -> Option<Self> {
+        let file = File::open(path).ok()?;
+        let len = file.metadata().ok()?.len() as usize;
+        if len == 0 {
+            return None;
+        }
+        // The mapping stays valid after the file is closed
+        let ptr = unsafe { libc::mmap(std::ptr::null_mut(), len, libc::PROT_READ, libc::MAP_PRIVATE, file.as_raw_fd(), 0) };
+        (ptr != libc::MAP_FAILED).then_some(Self { ptr, len })
+    }
+
+    fn bytes(&self) -> &[u8] {
+        unsafe { std::slice::from_raw_parts(self.ptr as *const u8, self.len) }
+    }
+}
+
+impl Drop for MappedFile {
+    fn drop(&mut self) {
+        unsafe {
+            libc::munmap(self.ptr, self.len);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    const SECRET: [u8; CACHE_SECRET_SIZE] = [7; CACHE_SECRET_SIZE];
+
+    // A fresh path in the temporary directory, removed when dropped
+    struct CachePath(String);
+
+    impl CachePath {
+        fn new(name: &str) -> Self {
+            let path = std::env::temp_dir().join(format!("provable-{}-{}.cache", name, std::process::id()));
+            let _ = fs::remove_file(&path);
+            Self(path.to_string_lossy().into_owned())
+        }
+    }
+
+    impl Drop for CachePath {
+        fn drop(&mut self) {
+            let _ = fs::remove_file(&self.0);
+        }
+    }
+
+    fn private_keys(count: usize) -> Vec<String> {
+        (0..count).map(|_| PrivateKey::<CurrentNetwork>::new(&mut rand::thread_rng()).unwrap().to_string()).collect()
+    }
+
+    fn restore(path: &CachePath, secret: &[u8], keys: &[String]) -> Vec<RestoredAccount> {
+        let keys: Vec<&[u8]> = keys.iter().map(|key| key.as_bytes()).collect();
+        restore_accounts(&path.0, secret, &keys).unwrap()
+    }
+
+    fn cached(accounts: &[RestoredAccount]) -> Vec<bool> {
+        accounts.iter().map(|account| account.cached).collect()
+    }
+
+    fn assert_same_accounts(left: &[RestoredAccount], right: &[RestoredAccount]) {
+        assert_eq!(left.len(), right.len());
+        for (left, right) in left.iter().zip(right) {
+            assert!(left.view_key == right.view_key);
+            assert!(left.address == right.address);
+        }
+    }
+
+    #[test]
+    fn second_restore_reads_every_account_from_the_cache() {
+        let path = CachePath::new("restore");
+        let keys = private_keys(3);
+
+        let derived = restore(&path, &SECRET, &keys);
+        assert_eq!(cached(&derived), [false; 3]);
+        let restored = restore(&path, &SECRET, &keys);
+        assert_eq!(cached(&restored), [true; 3]);
+        assert_same_accounts(&derived, &restored);
+
+        // Entries written under another secret are unreadable, so everything is derived again
+        let other = restore(&path, &[8; CACHE_SECRET_SIZE], &keys);
+        assert_eq!(cached(&other), [false; 3]);
+        assert_same_accounts(&derived, &other);
+    }
+
+    #[test]
+    fn corrupted_entry_is_derived_and_the_file_rewritten() {
+        let path = CachePath::new("corrupt");
+        let keys = private_keys(3);
+        let derived = restore(&path, &SECRET, &keys);
+
+        // Flip the low bit of the second entry's encrypted view key, which keeps the field element canonical
+        let mut bytes = fs::read(&path.0).unwrap();
+        bytes[HEADER_SIZE + ENTRY_SIZE + 2 * FIELD_SIZE] ^= 1;
+        fs::write(&path.0, &bytes).unwrap();
+
+        let restored = restore(&path, &SECRET, &keys);
+        assert_eq!(cached(&restored), [true, false, true]);
+        assert_same_accounts(&derived, &restored);
+        assert_ne!(fs::read(&path.0).unwrap(), bytes);
+
+        let rewritten = restore(&path, &SECRET, &keys);
+        assert_eq!(cached(&rewritten), [true; 3]);
+        assert_same_accounts(&derived, &rewritten);
+    }
+}
@@ -1,10 +1,37 @@
-use std::collections::HashMap;
+mod batch;
+mod cache;
+mod disk_cache;
+mod nonce_pool;
+pub mod registry;
+pub mod records;
+mod schnorr;
+pub mod secure;
+pub mod signing;
+mod stats;
+pub mod stream;
+mod validation;
+pub mod vanity;
+
+use std::cell::RefCell;
 use std::sync::{Mutex, OnceLock};
-use std::str::FromStr;
+use std::time::Instant;
+use cache::{AddressCache, DerivationCache};
+use nonce_pool::NoncePool;
+use batch::{address_verify_batch, derive_accounts, pack_with_offsets, private_key_sign_batch, signature_batch_size, unpack_with_offsets};
+use rayon::prelude::*;
+use records::scan_records;
+use registry::Registry;
+use signing::{SigningContext, SigningKey};
+use schnorr::{append_packed_fields, message_field_count, message_to_fields};
+use stats::Operation;
+use stream::{is_stream_message, signed_message, StreamHasher};
+use validation::{validate_addresses, validate_private_keys, validate_view_keys};
+use vanity::VanitySearch;
 use snarkvm_console::{
     account::{Address, PrivateKey, Signature, ViewKey},
-    network::MainnetV0,
-    prelude::{FromBytes, ToBytes},
+    network::{MainnetV0, Network},
+    prelude::{FromBytes, SizeInBytes, ToBytes},
+    types::{Field, Scalar},
 };
 
 type CurrentNetwork = MainnetV0;
@@ -28,75 +55,274 @@ mod ffi {
         id: u64,
     }
 
+    struct VanitySearchHandle {
+        id: u64,
+    }
+
+    struct StreamHandle {
+        id: u64,
+    }
+
+    struct EncodedMessageHandle {
+        id: u64,
+    }
+
     struct AccountResult {
         success: bool,
         result: String,
         error: String,
     }
 
-    struct SignatureResult {
+    // Outcome of signing into a caller-provided buffer, reported without
+    // allocating an error string
+    enum SignStatus {
+        Ok,
+        InvalidHandle,
+        WrongBufferSize,
+        MessageTooLong,
+        InvalidMessage,
+        SigningFailed,
+    }
+
+    struct BytesResult {
         success: bool,
-        signature_bytes: Vec<u8>,
+        bytes: Vec<u8>,
         error: String,
     }
 
+    // Bit i (LSB first) of `bitmap` is set when entry i is valid. When parsing
+    // was requested, `handles` holds the handle of each valid entry in order
+    struct ValidationResult {
+        success: bool,
+        bitmap: Vec<u8>,
+        handles: Vec<u64>,
+        error: String,
+    }
+
+    // Nanoseconds spent in each warm-up phase, near zero for anything that was already initialized
+    #[derive(Clone, Copy)]
+    struct WarmUpTimings {
+        registries_nanos: u64,
+        network_nanos: u64,
+        signing_context_nanos: u64,
+        thread_pool_nanos: u64,
+        total_nanos: u64,
+    }
+
+    struct RestoredAccount {
+        private_key: PrivateKeyHandle,
+        view_key: ViewKeyHandle,
+        address: AddressHandle,
+    }
+
+    // `cached` accounts were read from the cache file, `derived` ones had to be recomputed
+    struct RestoreResult {
+        success: bool,
+        accounts: Vec<RestoredAccount>,
+        cached: u32,
+        derived: u32,
+        error: String,
+    }
+
+    struct VanityProgress {
+        attempts: u64,
+        elapsed_seconds: f64,
+    }
+
+    struct CacheStats {
+        hits: u64,
+        misses: u64,
+        size: u64,
+        capacity: u64,
+    }
+
+    // Signatures that took a precomputed nonce, and ones that found the pool empty and computed their own
+    struct NoncePoolCounters {
+        available: u64,
+        depth: u64,
+        pooled_signatures: u64,
+        inline_signatures: u64,
+    }
+
+    // Latencies in nanoseconds, percentiles are read from a log-scale histogram
+    struct OperationCounters {
+        count: u64,
+        total_nanos: u64,
+        p50_nanos: u64,
+        p90_nanos: u64,
+        p99_nanos: u64,
+        max_nanos: u64,
+    }
+
+    struct RegistryCounters {
+        live_handles: u64,
+        lock_wait_nanos: u64,
+    }
+
+    struct StatsSnapshot {
+        enabled: bool,
+        parse: OperationCounters,
+        derive: OperationCounters,
+        sign: OperationCounters,
+        verify: OperationCounters,
+        batch: OperationCounters,
+        marshal: OperationCounters,
+        private_keys: RegistryCounters,
+        addresses: RegistryCounters,
+        view_keys: RegistryCounters,
+        streams: RegistryCounters,
+        vanity_searches: RegistryCounters,
+        bytes_copied: u64,
+    }
+
     // Rust functions exposed to C++
     extern "Rust" {
         fn create_private_key() -> PrivateKeyHandle;
-        fn private_key_from_string(private_key_str: String) -> PrivateKeyHandle;
-        fn private_key_to_string(handle: &PrivateKeyHandle) -> AccountResult;
+        fn private_key_from_string(private_key_str: &str) -> PrivateKeyHandle;
+        fn private_key_write_string(handle: &PrivateKeyHandle, out: &mut [u8]) -> usize;
         fn private_key_to_address(handle: &PrivateKeyHandle) -> AddressHandle;
         fn private_key_to_view_key(handle: &PrivateKeyHandle) -> ViewKeyHandle;
-        fn private_key_sign(handle: &PrivateKeyHandle, message: Vec<u8>) -> SignatureResult;
-        fn validate_private_key(private_key_str: String) -> bool;
+        fn private_key_sign(handle: &PrivateKeyHandle, message: &[u8], signature: &mut [u8]) -> SignStatus;
+        fn private_key_sign_fields(handle: &PrivateKeyHandle, fields: &[u8], signature: &mut [u8]) -> SignStatus;
+        fn private_key_sign_encoded(handle: &PrivateKeyHandle, message: &EncodedMessageHandle, signature: &mut [u8]) -> SignStatus;
+        fn private_key_sign_batch(handle: &PrivateKeyHandle, messages: &[u8], lengths: &[u32], signatures: &mut [u8]) -> AccountResult;
+        fn private_key_to_bytes(handle: &PrivateKeyHandle, bytes: &mut [u8]) -> AccountResult;
+        fn private_key_from_bytes(bytes: &[u8]) -> PrivateKeyHandle;
+        fn private_key_size_in_bytes() -> usize;
+        fn validate_private_key(private_key_str: &str) -> bool;
         fn destroy_private_key(handle: &PrivateKeyHandle);
 
-        fn address_from_string(address_str: String) -> AddressHandle;
+        fn address_from_string(address_str: &str) -> AddressHandle;
         fn address_to_string(handle: &AddressHandle) -> AccountResult;
-        fn address_verify(handle: &AddressHandle, signature_bytes: Vec<u8>, message: Vec<u8>) -> bool;
-        fn validate_address(address_str: String) -> bool;
+        fn address_verify(handle: &AddressHandle, signature_bytes: &[u8], message: &[u8]) -> bool;
+        fn address_verify_fields(handle: &AddressHandle, signature_bytes: &[u8], fields: &[u8]) -> bool;
+        fn address_verify_encoded(handle: &AddressHandle, signature_bytes: &[u8], message: &EncodedMessageHandle) -> bool;
+        fn address_verify_batch(triples: &[u8]) -> BytesResult;
+        fn address_to_bytes(handle: &AddressHandle, bytes: &mut [u8]) -> AccountResult;
+        fn address_from_bytes(bytes: &[u8]) -> AddressHandle;
+        fn address_size_in_bytes() -> usize;
+        fn validate_address(address_str: &str) -> bool;
         fn destroy_address(handle: &AddressHandle);
 
-        fn view_key_from_string(view_key_str: String) -> ViewKeyHandle;
-        fn view_key_to_string(handle: &ViewKeyHandle) -> AccountResult;
+        fn view_key_from_string(view_key_str: &str) -> ViewKeyHandle;
+        fn view_key_write_string(handle: &ViewKeyHandle, out: &mut [u8]) -> usize;
         fn view_key_to_address(handle: &ViewKeyHandle) -> AddressHandle;
-        fn validate_view_key(view_key_str: String) -> bool;
+        fn view_key_to_bytes(handle: &ViewKeyHandle, bytes: &mut [u8]) -> AccountResult;
+        fn view_key_from_bytes(bytes: &[u8]) -> ViewKeyHandle;
+        fn view_key_size_in_bytes() -> usize;
+        fn view_key_scan_records(handle: &ViewKeyHandle, records: &[u8]) -> BytesResult;
+        fn validate_view_key(view_key_str: &str) -> bool;
         fn destroy_view_key(handle: &ViewKeyHandle);
 
         fn destroy_signature(handle: &SignatureHandle);
+
+        fn signature_size_in_bytes() -> usize;
+        fn sign_status_message(status: SignStatus) -> &'static str;
+        fn signature_batch_size(count: usize) -> usize;
+
+        fn encoded_message_from_bytes(message: &[u8]) -> EncodedMessageHandle;
+        fn encoded_message_from_fields(fields: &[u8]) -> EncodedMessageHandle;
+        fn encoded_message_field_count(handle: &EncodedMessageHandle) -> usize;
+        fn encoded_message_to_fields(handle: &EncodedMessageHandle, fields: &mut [u8]) -> AccountResult;
+        fn destroy_encoded_message(handle: &EncodedMessageHandle);
+
+        fn set_derivation_cache_capacity(capacity: usize);
+        fn derivation_cache_stats() -> CacheStats;
+        fn set_nonce_pool(depth: usize, refill_below: usize);
+        fn nonce_pool_stats() -> NoncePoolCounters;
+
+        fn prepare_signing_context();
+        fn warm_up() -> WarmUpTimings;
+        fn derive_accounts(seed: &[u8], start_index: u32, count: u32) -> BytesResult;
+        fn restore_accounts(path: &str, secret: &[u8], private_keys: &[u8]) -> RestoreResult;
+
+        fn vanity_search_new(prefix: String, suffix: String) -> VanitySearchHandle;
+        fn vanity_search_run(handle: &VanitySearchHandle, threads: usize) -> PrivateKeyHandle;
+        fn vanity_search_progress(handle: &VanitySearchHandle) -> VanityProgress;
+        fn vanity_search_cancel(handle: &VanitySearchHandle);
+        fn destroy_vanity_search(handle: &VanitySearchHandle);
+
+        fn stream_new() -> StreamHandle;
+        fn stream_update(handle: &StreamHandle, chunk: &[u8]) -> AccountResult;
+        fn stream_sign(handle: &StreamHandle, private_key: &PrivateKeyHandle, signature: &mut [u8]) -> AccountResult;
+        fn stream_verify(handle: &StreamHandle, address: &AddressHandle, signature_bytes: &[u8]) -> bool;
+        fn destroy_stream(handle: &StreamHandle);
+
+        fn set_address_cache_capacity(capacity: usize);
+        fn warm_address_cache(addresses: Vec<String>) -> usize;
+
+        fn validate_addresses(packed: &[u8], parse: bool) -> ValidationResult;
+        fn validate_private_keys(packed: &[u8], parse: bool) -> ValidationResult;
+        fn validate_view_keys(packed: &[u8], parse: bool) -> ValidationResult;
+
+        fn set_stats_enabled(enabled: bool);
+        fn stats_enabled() -> bool;
+        fn stats_snapshot() -> StatsSnapshot;
+        fn reset_stats();
+        fn record_marshal(nanos: u64, bytes: u64);
     }
 }
 
 // Storage for cryptographic objects using handles
-static PRIVATE_KEYS: OnceLock<Mutex<HashMap<u64, PrivateKey<CurrentNetwork>>>> = OnceLock::new();
-static ADDRESSES: OnceLock<Mutex<HashMap<u64, Address<CurrentNetwork>>>> = OnceLock::new();
-static VIEW_KEYS: OnceLock<Mutex<HashMap<u64, ViewKey<CurrentNetwork>>>> = OnceLock::new();
-static SIGNATURES: OnceLock<Mutex<HashMap<u64, Signature<CurrentNetwork>>>> = OnceLock::new();
-static NEXT_ID: Mutex<u64> = Mutex::new(1);
+static PRIVATE_KEYS: OnceLock<Registry<SigningKey<CurrentNetwork>>> = OnceLock::new();
+static ADDRESSES: OnceLock<Registry<Address<CurrentNetwork>>> = OnceLock::new();
+static VIEW_KEYS: OnceLock<Registry<ViewKey<CurrentNetwork>>> = OnceLock::new();
+static SIGNATURES: OnceLock<Registry<Signature<CurrentNetwork>>> = OnceLock::new();
+static DERIVATIONS: OnceLock<DerivationCache> = OnceLock::new();
+static NONCES: OnceLock<NoncePool> = OnceLock::new();
+static PARSED_ADDRESSES: OnceLock<AddressCache> = OnceLock::new();
+static SIGNING_CONTEXT: OnceLock<SigningContext<CurrentNetwork>> = OnceLock::new();
+static VANITY_SEARCHES: OnceLock<Registry<VanitySearch<CurrentNetwork>>> = OnceLock::new();
+// Finished streams hold `None`
+static STREAMS: OnceLock<Registry<Mutex<Option<StreamHasher<CurrentNetwork>>>>> = OnceLock::new();
+static ENCODED_MESSAGES: OnceLock<Registry<Vec<Field<CurrentNetwork>>>> = OnceLock::new();
+static WARM_UP: OnceLock<ffi::WarmUpTimings> = OnceLock::new();
+
+const DEFAULT_ADDRESS_CACHE_CAPACITY: usize = 256;
 
 // Initialize storage
-fn ensure_private_key_storage() -> &'static Mutex<HashMap<u64, PrivateKey<CurrentNetwork>>> {
-    PRIVATE_KEYS.get_or_init(|| Mutex::new(HashMap::new()))
+fn ensure_private_key_storage() -> &'static Registry<SigningKey<CurrentNetwork>> {
+    PRIVATE_KEYS.get_or_init(Registry::new)
+}
+
+fn ensure_address_storage() -> &'static Registry<Address<CurrentNetwork>> {
+    ADDRESSES.get_or_init(Registry::new)
 }
 
-fn ensure_address_storage() -> &'static Mutex<HashMap<u64, Address<CurrentNetwork>>> {
-    ADDRESSES.get_or_init(|| Mutex::new(HashMap::new()))
+fn ensure_view_key_storage() -> &'static Registry<ViewKey<CurrentNetwork>> {
+    VIEW_KEYS.get_or_init(Registry::new)
 }
 
-fn ensure_view_key_storage() -> &'static Mutex<HashMap<u64, ViewKey<CurrentNetwork>>> {
-    VIEW_KEYS.get_or_init(|| Mutex::new(HashMap::new()))
+fn ensure_signature_storage() -> &'static Registry<Signature<CurrentNetwork>> {
+    SIGNATURES.get_or_init(Registry::new)
 }
 
-fn ensure_signature_storage() -> &'static Mutex<HashMap<u64, Signature<CurrentNetwork>>> {
-    SIGNATURES.get_or_init(|| Mutex::new(HashMap::new()))
+fn ensure_vanity_search_storage() -> &'static Registry<VanitySearch<CurrentNetwork>> {
+    VANITY_SEARCHES.get_or_init(Registry::new)
 }
 
-// Get the next unique ID
-fn get_next_id() -> u64 {
-    let mut id = NEXT_ID.lock().unwrap();
-    let current = *id;
-    *id += 1;
-    current
+fn ensure_stream_storage() -> &'static Registry<Mutex<Option<StreamHasher<CurrentNetwork>>>> {
+    STREAMS.get_or_init(Registry::new)
+}
+
+fn ensure_encoded_message_storage() -> &'static Registry<Vec<Field<CurrentNetwork>>> {
+    ENCODED_MESSAGES.get_or_init(Registry::new)
+}
+
+fn derivation_cache() -> &'static DerivationCache {
+    DERIVATIONS.get_or_init(DerivationCache::new)
+}
+
+fn nonce_pool() -> &'static NoncePool {
+    NONCES.get_or_init(NoncePool::new)
+}
+
+fn signing_context() -> &'static SigningContext<CurrentNetwork> {
+    SIGNING_CONTEXT.get_or_init(SigningContext::new)
+}
+
+fn address_cache() -> &'static AddressCache {
+    PARSED_ADDRESSES.get_or_init(|| AddressCache::new(DEFAULT_ADDRESS_CACHE_CAPACITY))
 }
 
 // Helper functions to create results
@@ -116,18 +342,18 @@ fn success_result(result: String) -> ffi::AccountResult {
     }
 }
 
-fn signature_error_result(error: String) -> ffi::SignatureResult {
-    ffi::SignatureResult {
+fn bytes_error_result(error: String) -> ffi::BytesResult {
+    ffi::BytesResult {
         success: false,
-        signature_bytes: Vec::new(),
+        bytes: Vec::new(),
         error,
     }
 }
 
-fn signature_success_result(signature_bytes: Vec<u8>) -> ffi::SignatureResult {
-    ffi::SignatureResult {
+fn bytes_success_result(bytes: Vec<u8>) -> ffi::BytesResult {
+    ffi::BytesResult {
         success: true,
-        signature_bytes,
+        bytes,
         error: String::new(),
     }
 }
@@ -137,205 +363,655 @@ fn signature_success_result(signature_bytes: Vec<u8>) -> ffi::SignatureResult {
 // Private key functions
 pub fn create_private_key() -> ffi::PrivateKeyHandle {
     let private_key = PrivateKey::<CurrentNetwork>::new(&mut rand::thread_rng()).unwrap();
-    let id = get_next_id();
-    
-    let storage = ensure_private_key_storage();
-    let mut map = storage.lock().unwrap();
-    map.insert(id, private_key);
-    
+    let id = ensure_private_key_storage().insert(SigningKey::new(private_key));
     ffi::PrivateKeyHandle { id }
 }
 
-pub fn private_key_from_string(private_key_str: String) -> ffi::PrivateKeyHandle {
-    match PrivateKey::<CurrentNetwork>::from_str(&private_key_str) {
-        Ok(private_key) => {
-            let id = get_next_id();
-            let storage = ensure_private_key_storage();
-            let mut keys = storage.lock().unwrap();
-            keys.insert(id, private_key);
-            ffi::PrivateKeyHandle { id }
-        }
-        Err(_) => ffi::PrivateKeyHandle { id: 0 }, // Invalid handle
+pub fn private_key_from_string(private_key_str: &str) -> ffi::PrivateKeyHandle {
+    match stats::timed(Operation::Parse, || secure::parse_private_key::<CurrentNetwork>(private_key_str)) {
+        Some(private_key) => ffi::PrivateKeyHandle { id: ensure_private_key_storage().insert(SigningKey::new(private_key)) },
+        None => ffi::PrivateKeyHandle { id: 0 }, // Invalid handle
     }
 }
 
-pub fn private_key_to_string(handle: &ffi::PrivateKeyHandle) -> ffi::AccountResult {
-    let storage = ensure_private_key_storage();
-    let keys = storage.lock().unwrap();
-    
-    if let Some(key) = keys.get(&handle.id) {
-        success_result(key.to_string())
-    } else {
-        error_result("Invalid private key handle".to_string())
-    }
+// Writes the string form into `out` without allocating, returning its length or 0 for an invalid handle
+pub fn private_key_write_string(handle: &ffi::PrivateKeyHandle, out: &mut [u8]) -> usize {
+    ensure_private_key_storage().get(handle.id).and_then(|key| secure::write_private_key(key.private_key(), out)).unwrap_or(0)
 }
 
 pub fn private_key_to_address(handle: &ffi::PrivateKeyHandle) -> ffi::AddressHandle {
-    let storage = ensure_private_key_storage();
-    let keys = storage.lock().unwrap();
-    
-    if let Some(key) = keys.get(&handle.id) {
-        let address = Address::<CurrentNetwork>::try_from(key).unwrap();
-        let id = get_next_id();
-        let addr_storage = ensure_address_storage();
-        let mut addresses = addr_storage.lock().unwrap();
-        addresses.insert(id, address);
-        ffi::AddressHandle { id }
-    } else {
-        ffi::AddressHandle { id: 0 } // Invalid handle
+    match ensure_private_key_storage().get(handle.id) {
+        Some(key) => match stats::timed(Operation::Derive, || derivation_cache().address(key.private_key())) {
+            Some(address) => ffi::AddressHandle { id: ensure_address_storage().insert_arc(address) },
+            None => ffi::AddressHandle { id: 0 }, // Invalid handle
+        },
+        None => ffi::AddressHandle { id: 0 }, // Invalid handle
     }
 }
 
 pub fn private_key_to_view_key(handle: &ffi::PrivateKeyHandle) -> ffi::ViewKeyHandle {
-    let storage = ensure_private_key_storage();
-    let keys = storage.lock().unwrap();
-    
-    if let Some(key) = keys.get(&handle.id) {
-        let view_key = ViewKey::<CurrentNetwork>::try_from(key).unwrap();
-        let id = get_next_id();
-        let vk_storage = ensure_view_key_storage();
-        let mut view_keys = vk_storage.lock().unwrap();
-        view_keys.insert(id, view_key);
-        ffi::ViewKeyHandle { id }
-    } else {
-        ffi::ViewKeyHandle { id: 0 } // Invalid handle
+    match ensure_private_key_storage().get(handle.id) {
+        Some(key) => match stats::timed(Operation::Derive, || derivation_cache().view_key(key.private_key())) {
+            Some(view_key) => ffi::ViewKeyHandle { id: ensure_view_key_storage().insert(view_key) },
+            None => ffi::ViewKeyHandle { id: 0 }, // Invalid handle
+        },
+        None => ffi::ViewKeyHandle { id: 0 }, // Invalid handle
     }
 }
 
-pub fn private_key_sign(handle: &ffi::PrivateKeyHandle, message: Vec<u8>) -> ffi::SignatureResult {
-    let storage = ensure_private_key_storage();
-    let keys = storage.lock().unwrap();
-    
-    if let Some(key) = keys.get(&handle.id) {
-        match key.sign_bytes(&message, &mut rand::thread_rng()) {
-            Ok(signature) => {
-                let signature_bytes = signature.to_bytes_le().unwrap();
-                signature_success_result(signature_bytes)
-            }
-            Err(e) => signature_error_result(format!("Signing failed: {}", e)),
+pub fn private_key_sign(handle: &ffi::PrivateKeyHandle, message: &[u8], signature: &mut [u8]) -> ffi::SignStatus {
+    match ensure_private_key_storage().get(handle.id) {
+        Some(key) => sign_into(&key, message, signature, true),
+        None => ffi::SignStatus::InvalidHandle,
+    }
+}
+
+// `fields` holds field elements packed as 32-byte little-endian values, signed as they are instead of as bytes
+pub fn private_key_sign_fields(handle: &ffi::PrivateKeyHandle, fields: &[u8], signature: &mut [u8]) -> ffi::SignStatus {
+    let Some(key) = ensure_private_key_storage().get(handle.id) else {
+        return ffi::SignStatus::InvalidHandle;
+    };
+    if fields.len() / Field::<CurrentNetwork>::size_in_bytes() > CurrentNetwork::MAX_DATA_SIZE_IN_FIELDS as usize {
+        return ffi::SignStatus::MessageTooLong;
+    }
+    with_packed_fields(fields, |message| match message {
+        Some(message) => sign_fields_into(&key, message, signature, true),
+        None => ffi::SignStatus::InvalidMessage,
+    })
+}
+
+pub fn private_key_sign_encoded(handle: &ffi::PrivateKeyHandle, message: &ffi::EncodedMessageHandle, signature: &mut [u8]) -> ffi::SignStatus {
+    let Some(key) = ensure_private_key_storage().get(handle.id) else {
+        return ffi::SignStatus::InvalidHandle;
+    };
+    match ensure_encoded_message_storage().get(message.id) {
+        Some(message) => sign_fields_into(&key, &message, signature, true),
+        None => ffi::SignStatus::InvalidMessage,
+    }
+}
+
+// Preimages above this many fields (a ~128 KB message) are freed after use instead of kept for the thread's lifetime
+const MAX_RETAINED_PREIMAGE: usize = 4096;
+
+thread_local! {
+    // Hash preimage reused by every signature on this thread, so that once it has grown to fit
+    // the thread's messages, signing into a caller-provided buffer never touches the allocator
+    static PREIMAGE: RefCell<Vec<Field<CurrentNetwork>>> = const { RefCell::new(Vec::new()) };
+    // Packed field elements decoded for `private_key_sign_fields` and `address_verify_fields`
+    static PACKED_FIELDS: RefCell<Vec<Field<CurrentNetwork>>> = const { RefCell::new(Vec::new()) };
+}
+
+// Decodes packed field elements into this thread's reused buffer for `f`, which gets `None` when `packed` is not
+// a whole number of canonical field elements or has the layout reserved for stream signatures
+fn with_packed_fields<T>(packed: &[u8], f: impl FnOnce(Option<&[Field<CurrentNetwork>]>) -> T) -> T {
+    PACKED_FIELDS.with_borrow_mut(|fields| {
+        fields.clear();
+        let decoded = append_packed_fields(packed, fields) && !is_stream_message(fields);
+        let result = f(decoded.then_some(&fields[..]));
+        if fields.capacity() > MAX_RETAINED_PREIMAGE {
+            *fields = Vec::new();
         }
-    } else {
-        signature_error_result("Invalid private key handle".to_string())
+        result
+    })
+}
+
+// Signs `message` and serializes the signature straight into `out`. With `pooled`, the nonce and its commitment come
+// from the nonce pool when it has one ready. Batches sign without it, so they don't drain the pool interactive
+// signatures rely on
+fn sign_into(key: &SigningKey<CurrentNetwork>, message: &[u8], out: &mut [u8], pooled: bool) -> ffi::SignStatus {
+    sign_with_nonce_into(message_field_count::<CurrentNetwork>(message.len()), out, pooled, |preimage, nonce, commitment| {
+        signing_context().sign_bytes_with_nonce(key, message, preimage, nonce, commitment).ok()
+    })
+}
+
+// `sign_into` for a message that is already field elements
+fn sign_fields_into(key: &SigningKey<CurrentNetwork>, message: &[Field<CurrentNetwork>], out: &mut [u8], pooled: bool) -> ffi::SignStatus {
+    sign_with_nonce_into(message.len(), out, pooled, |preimage, nonce, commitment| {
+        signing_context().sign_fields_with_nonce(key, message, preimage, nonce, commitment).ok()
+    })
+}
+
+// Checks the buffer and the message's `field_count` against the limit, then runs `sign` with this thread's preimage
+// and a nonce and writes the signature into `out`
+fn sign_with_nonce_into(
+    field_count: usize,
+    out: &mut [u8],
+    pooled: bool,
+    sign: impl FnOnce(&mut Vec<Field<CurrentNetwork>>, Scalar<CurrentNetwork>, Field<CurrentNetwork>) -> Option<Signature<CurrentNetwork>>,
+) -> ffi::SignStatus {
+    if out.len() != signature_size_in_bytes() {
+        return ffi::SignStatus::WrongBufferSize;
+    }
+    if field_count > CurrentNetwork::MAX_DATA_SIZE_IN_FIELDS as usize {
+        return ffi::SignStatus::MessageTooLong;
+    }
+    stats::timed(Operation::Sign, || {
+        PREIMAGE.with_borrow_mut(|preimage| {
+            let nonce = if pooled { nonce_pool().take() } else { None };
+            let (nonce, commitment) = nonce.unwrap_or_else(|| signing_context().nonce_commitment(&mut rand::thread_rng()));
+            let signed = sign(preimage, nonce, commitment).is_some_and(|signature| signature.write_le(&mut *out).is_ok());
+            if preimage.capacity() > MAX_RETAINED_PREIMAGE {
+                *preimage = Vec::new();
+            }
+            if signed { ffi::SignStatus::Ok } else { ffi::SignStatus::SigningFailed }
+        })
+    })
+}
+
+// Writes the key's 32-byte seed, the other key components are derived from it
+pub fn private_key_to_bytes(handle: &ffi::PrivateKeyHandle, bytes: &mut [u8]) -> ffi::AccountResult {
+    match ensure_private_key_storage().get(handle.id) {
+        Some(key) => write_bytes(key.private_key(), bytes),
+        None => error_result("Invalid private key handle".to_string()),
+    }
+}
+
+pub fn private_key_from_bytes(bytes: &[u8]) -> ffi::PrivateKeyHandle {
+    match stats::timed(Operation::Parse, || read_bytes::<PrivateKey<CurrentNetwork>>(bytes, private_key_size_in_bytes())) {
+        Some(private_key) => ffi::PrivateKeyHandle { id: ensure_private_key_storage().insert(SigningKey::new(private_key)) },
+        None => ffi::PrivateKeyHandle { id: 0 }, // Invalid handle
     }
 }
 
-pub fn validate_private_key(private_key_str: String) -> bool {
-    private_key_str.parse::<PrivateKey<CurrentNetwork>>().is_ok()
+pub fn private_key_size_in_bytes() -> usize {
+    Field::<CurrentNetwork>::size_in_bytes()
+}
+
+// Serializes `value` into `bytes`, which must be exactly its fixed size
+fn write_bytes<T: ToBytes>(value: &T, bytes: &mut [u8]) -> ffi::AccountResult {
+    let mut writer = &mut bytes[..];
+    match value.write_le(&mut writer) {
+        Ok(()) if writer.is_empty() => success_result(String::new()),
+        Ok(()) => error_result("Output buffer has the wrong size".to_string()),
+        Err(e) => error_result(format!("Serialization failed: {}", e)),
+    }
+}
+
+// Rejects trailing bytes, which `from_bytes_le` would otherwise ignore
+fn read_bytes<T: FromBytes>(bytes: &[u8], size: usize) -> Option<T> {
+    (bytes.len() == size).then(|| T::from_bytes_le(bytes).ok()).flatten()
+}
+
+pub fn validate_private_key(private_key_str: &str) -> bool {
+    secure::parse_private_key::<CurrentNetwork>(private_key_str).is_some()
 }
 
 pub fn destroy_private_key(handle: &ffi::PrivateKeyHandle) {
-    let storage = ensure_private_key_storage();
-    let mut keys = storage.lock().unwrap();
-    keys.remove(&handle.id);
+    ensure_private_key_storage().remove(handle.id);
 }
 
 // Address functions
-pub fn address_from_string(address_str: String) -> ffi::AddressHandle {
-    match address_str.parse::<Address<CurrentNetwork>>() {
-        Ok(address) => {
-            let id = get_next_id();
-            let storage = ensure_address_storage();
-            let mut addresses = storage.lock().unwrap();
-            addresses.insert(id, address);
-            ffi::AddressHandle { id }
-        }
-        Err(_) => ffi::AddressHandle { id: 0 }, // Invalid handle
+pub fn address_from_string(address_str: &str) -> ffi::AddressHandle {
+    match stats::timed(Operation::Parse, || address_cache().get_or_parse(address_str)) {
+        Some(address) => ffi::AddressHandle { id: ensure_address_storage().insert_arc(address) },
+        None => ffi::AddressHandle { id: 0 }, // Invalid handle
     }
 }
 
 pub fn address_to_string(handle: &ffi::AddressHandle) -> ffi::AccountResult {
-    let storage = ensure_address_storage();
-    let addresses = storage.lock().unwrap();
-    
-    if let Some(address) = addresses.get(&handle.id) {
-        success_result(address.to_string())
-    } else {
-        error_result("Invalid address handle".to_string())
+    match ensure_address_storage().get(handle.id) {
+        Some(address) => success_result(address.to_string()),
+        None => error_result("Invalid address handle".to_string()),
     }
 }
 
-pub fn address_verify(handle: &ffi::AddressHandle, signature_bytes: Vec<u8>, message: Vec<u8>) -> bool {
-    let storage = ensure_address_storage();
-    let addresses = storage.lock().unwrap();
-    
-    if let Some(address) = addresses.get(&handle.id) {
-        match Signature::<CurrentNetwork>::from_bytes_le(&signature_bytes) {
-            Ok(signature) => signature.verify_bytes(address, &message),
+pub fn address_verify(handle: &ffi::AddressHandle, signature_bytes: &[u8], message: &[u8]) -> bool {
+    match ensure_address_storage().get(handle.id) {
+        Some(address) => match Signature::<CurrentNetwork>::from_bytes_le(signature_bytes) {
+            Ok(signature) => stats::timed(Operation::Verify, || signing_context().verify_bytes(&signature, &address, message)),
             Err(_) => false,
-        }
-    } else {
-        false
+        },
+        None => false,
+    }
+}
+
+pub fn address_verify_fields(handle: &ffi::AddressHandle, signature_bytes: &[u8], fields: &[u8]) -> bool {
+    match ensure_address_storage().get(handle.id) {
+        Some(address) => match Signature::<CurrentNetwork>::from_bytes_le(signature_bytes) {
+            Ok(signature) => with_packed_fields(fields, |message| {
+                message.is_some_and(|message| {
+                    stats::timed(Operation::Verify, || signing_context().verify_fields(&signature, &address, message))
+                })
+            }),
+            Err(_) => false,
+        },
+        None => false,
     }
 }
 
-pub fn validate_address(address_str: String) -> bool {
+pub fn address_verify_encoded(handle: &ffi::AddressHandle, signature_bytes: &[u8], message: &ffi::EncodedMessageHandle) -> bool {
+    match (ensure_address_storage().get(handle.id), ensure_encoded_message_storage().get(message.id)) {
+        (Some(address), Some(message)) => match Signature::<CurrentNetwork>::from_bytes_le(signature_bytes) {
+            Ok(signature) => stats::timed(Operation::Verify, || signing_context().verify_fields(&signature, &address, &message)),
+            Err(_) => false,
+        },
+        _ => false,
+    }
+}
+
+// Writes the address point's x-coordinate, `address_from_bytes` recovers the point and checks it is in the subgroup
+pub fn address_to_bytes(handle: &ffi::AddressHandle, bytes: &mut [u8]) -> ffi::AccountResult {
+    match ensure_address_storage().get(handle.id) {
+        Some(address) => write_bytes(&*address, bytes),
+        None => error_result("Invalid address handle".to_string()),
+    }
+}
+
+pub fn address_from_bytes(bytes: &[u8]) -> ffi::AddressHandle {
+    match stats::timed(Operation::Parse, || read_bytes::<Address<CurrentNetwork>>(bytes, address_size_in_bytes())) {
+        Some(address) => ffi::AddressHandle { id: ensure_address_storage().insert(address) },
+        None => ffi::AddressHandle { id: 0 }, // Invalid handle
+    }
+}
+
+pub fn address_size_in_bytes() -> usize {
+    Field::<CurrentNetwork>::size_in_bytes()
+}
+
+pub fn validate_address(address_str: &str) -> bool {
     address_str.parse::<Address<CurrentNetwork>>().is_ok()
 }
 
 pub fn destroy_address(handle: &ffi::AddressHandle) {
-    let storage = ensure_address_storage();
-    let mut addresses = storage.lock().unwrap();
-    addresses.remove(&handle.id);
+    ensure_address_storage().remove(handle.id);
 }
 
 // ViewKey functions
-pub fn view_key_from_string(view_key_str: String) -> ffi::ViewKeyHandle {
-    match view_key_str.parse::<ViewKey<CurrentNetwork>>() {
-        Ok(view_key) => {
-            let id = get_next_id();
-            let storage = ensure_view_key_storage();
-            let mut view_keys = storage.lock().unwrap();
-            view_keys.insert(id, view_key);
-            ffi::ViewKeyHandle { id }
-        }
-        Err(_) => ffi::ViewKeyHandle { id: 0 }, // Invalid handle
+pub fn view_key_from_string(view_key_str: &str) -> ffi::ViewKeyHandle {
+    match stats::timed(Operation::Parse, || secure::parse_view_key::<CurrentNetwork>(view_key_str)) {
+        Some(view_key) => ffi::ViewKeyHandle { id: ensure_view_key_storage().insert(view_key) },
+        None => ffi::ViewKeyHandle { id: 0 }, // Invalid handle
     }
 }
 
-pub fn view_key_to_string(handle: &ffi::ViewKeyHandle) -> ffi::AccountResult {
-    let storage = ensure_view_key_storage();
-    let view_keys = storage.lock().unwrap();
-    
-    if let Some(view_key) = view_keys.get(&handle.id) {
-        success_result(view_key.to_string())
-    } else {
-        error_result("Invalid view key handle".to_string())
-    }
+pub fn view_key_write_string(handle: &ffi::ViewKeyHandle, out: &mut [u8]) -> usize {
+    ensure_view_key_storage().get(handle.id).and_then(|view_key| secure::write_view_key(&view_key, out)).unwrap_or(0)
 }
 
 pub fn view_key_to_address(handle: &ffi::ViewKeyHandle) -> ffi::AddressHandle {
-    let storage = ensure_view_key_storage();
-    let view_keys = storage.lock().unwrap();
-    
-    if let Some(view_key) = view_keys.get(&handle.id) {
-        match Address::<CurrentNetwork>::try_from(view_key) {
-            Ok(address) => {
-                let id = get_next_id();
-                let addr_storage = ensure_address_storage();
-                let mut addresses = addr_storage.lock().unwrap();
-                addresses.insert(id, address);
-                ffi::AddressHandle { id }
-            }
-            Err(_) => ffi::AddressHandle { id: 0 }, // Invalid handle
+    match ensure_view_key_storage().get(handle.id) {
+        Some(view_key) => {
+            let address = stats::timed(Operation::Derive, || signing_context().view_key_to_address(&view_key));
+            ffi::AddressHandle { id: ensure_address_storage().insert(address) }
         }
-    } else {
-        ffi::AddressHandle { id: 0 } // Invalid handle
+        None => ffi::AddressHandle { id: 0 }, // Invalid handle
+    }
+}
+
+pub fn view_key_to_bytes(handle: &ffi::ViewKeyHandle, bytes: &mut [u8]) -> ffi::AccountResult {
+    match ensure_view_key_storage().get(handle.id) {
+        Some(view_key) => write_bytes(&*view_key, bytes),
+        None => error_result("Invalid view key handle".to_string()),
     }
 }
 
-pub fn validate_view_key(view_key_str: String) -> bool {
-    view_key_str.parse::<ViewKey<CurrentNetwork>>().is_ok()
+pub fn view_key_from_bytes(bytes: &[u8]) -> ffi::ViewKeyHandle {
+    match stats::timed(Operation::Parse, || read_bytes::<ViewKey<CurrentNetwork>>(bytes, view_key_size_in_bytes())) {
+        Some(view_key) => ffi::ViewKeyHandle { id: ensure_view_key_storage().insert(view_key) },
+        None => ffi::ViewKeyHandle { id: 0 }, // Invalid handle
+    }
+}
+
+pub fn view_key_size_in_bytes() -> usize {
+    Scalar::<CurrentNetwork>::size_in_bytes()
+}
+
+/// Packs one entry per record in `records` (packed ciphertext strings) owned
+/// by the view key: the record's u32 index in the batch, little-endian,
+/// followed by the decrypted record string.
+pub fn view_key_scan_records(handle: &ffi::ViewKeyHandle, records: &[u8]) -> ffi::BytesResult {
+    let Some(view_key) = ensure_view_key_storage().get(handle.id) else {
+        return bytes_error_result("Invalid view key handle".to_string());
+    };
+    let Some(records) = unpack_with_offsets(records) else {
+        return bytes_error_result("Malformed record batch".to_string());
+    };
+    let address_x = signing_context().view_key_to_address(&view_key).to_x_coordinate();
+    let owned = stats::timed(Operation::Batch, || scan_records(&view_key, &address_x, &records));
+    let entries: Vec<Vec<u8>> = owned
+        .into_iter()
+        .map(|(index, plaintext)| [index.to_le_bytes().as_slice(), plaintext.as_bytes()].concat())
+        .collect();
+    match pack_with_offsets(&entries) {
+        Some(packed) => bytes_success_result(packed),
+        None => bytes_error_result("The owned records do not fit in one result, scan smaller chunks".to_string()),
+    }
+}
+
+pub fn validate_view_key(view_key_str: &str) -> bool {
+    secure::parse_view_key::<CurrentNetwork>(view_key_str).is_some()
 }
 
 pub fn destroy_view_key(handle: &ffi::ViewKeyHandle) {
-    let storage = ensure_view_key_storage();
-    let mut view_keys = storage.lock().unwrap();
-    view_keys.remove(&handle.id);
+    ensure_view_key_storage().remove(handle.id);
 }
 
 // Signature functions
 pub fn destroy_signature(handle: &ffi::SignatureHandle) {
-    let storage = ensure_signature_storage();
-    let mut signatures = storage.lock().unwrap();
-    signatures.remove(&handle.id);
+    ensure_signature_storage().remove(handle.id);
+}
+
+// Signatures serialize as challenge, response and the compute key's (pk_sig, pr_sig) x-coordinates
+pub fn signature_size_in_bytes() -> usize {
+    2 * Scalar::<CurrentNetwork>::size_in_bytes() + 2 * Field::<CurrentNetwork>::size_in_bytes()
+}
+
+pub fn sign_status_message(status: ffi::SignStatus) -> &'static str {
+    match status {
+        ffi::SignStatus::Ok => "",
+        ffi::SignStatus::InvalidHandle => "Invalid private key handle",
+        ffi::SignStatus::WrongBufferSize => "Signature buffer has the wrong size",
+        ffi::SignStatus::MessageTooLong => "Signing failed: the message exceeds maximum allowed size",
+        ffi::SignStatus::InvalidMessage => "Invalid encoded message: expected 32-byte little-endian field elements, not starting with the largest one",
+        _ => "Signing failed",
+    }
+}
+
+// Encoded message functions
+// Packs the message once the way `private_key_sign` does on every call, 0 if it is too long to sign
+pub fn encoded_message_from_bytes(message: &[u8]) -> ffi::EncodedMessageHandle {
+    match message_to_fields::<CurrentNetwork>(message) {
+        Some(fields) if fields.len() <= CurrentNetwork::MAX_DATA_SIZE_IN_FIELDS as usize => {
+            ffi::EncodedMessageHandle { id: ensure_encoded_message_storage().insert(fields) }
+        }
+        _ => ffi::EncodedMessageHandle { id: 0 }, // Invalid handle
+    }
+}
+
+pub fn encoded_message_from_fields(fields: &[u8]) -> ffi::EncodedMessageHandle {
+    let count = fields.len() / Field::<CurrentNetwork>::size_in_bytes();
+    let mut message = Vec::with_capacity(count);
+    let valid = count <= CurrentNetwork::MAX_DATA_SIZE_IN_FIELDS as usize && append_packed_fields(fields, &mut message);
+    if valid && !is_stream_message(&message) {
+        ffi::EncodedMessageHandle { id: ensure_encoded_message_storage().insert(message) }
+    } else {
+        ffi::EncodedMessageHandle { id: 0 } // Invalid handle
+    }
+}
+
+pub fn encoded_message_field_count(handle: &ffi::EncodedMessageHandle) -> usize {
+    ensure_encoded_message_storage().get(handle.id).map_or(0, |message| message.len())
+}
+
+// Writes the fields packed the way `encoded_message_from_fields` reads them, `fields` must be exactly 32 bytes per field
+pub fn encoded_message_to_fields(handle: &ffi::EncodedMessageHandle, fields: &mut [u8]) -> ffi::AccountResult {
+    let Some(message) = ensure_encoded_message_storage().get(handle.id) else {
+        return error_result("Invalid encoded message handle".to_string());
+    };
+    let size = Field::<CurrentNetwork>::size_in_bytes();
+    if fields.len() != message.len() * size {
+        return error_result("Output buffer has the wrong size".to_string());
+    }
+    for (field, bytes) in message.iter().zip(fields.chunks_exact_mut(size)) {
+        if let Err(e) = field.write_le(bytes) {
+            return error_result(format!("Serialization failed: {}", e));
+        }
+    }
+    success_result(String::new())
+}
+
+pub fn destroy_encoded_message(handle: &ffi::EncodedMessageHandle) {
+    ensure_encoded_message_storage().remove(handle.id);
+}
+
+// Derivation cache functions
+pub fn set_derivation_cache_capacity(capacity: usize) {
+    derivation_cache().set_capacity(capacity);
+}
+
+pub fn derivation_cache_stats() -> ffi::CacheStats {
+    let (hits, misses, size, capacity) = derivation_cache().stats();
+    ffi::CacheStats { hits, misses, size: size as u64, capacity: capacity as u64 }
+}
+
+// Nonce pool functions
+pub fn set_nonce_pool(depth: usize, refill_below: usize) {
+    nonce_pool().configure(depth, refill_below);
+}
+
+pub fn nonce_pool_stats() -> ffi::NoncePoolCounters {
+    let (available, depth, pooled_signatures, inline_signatures) = nonce_pool().stats();
+    ffi::NoncePoolCounters { available: available as u64, depth: depth as u64, pooled_signatures, inline_signatures }
+}
+
+// Address cache functions
+pub fn set_address_cache_capacity(capacity: usize) {
+    address_cache().set_capacity(capacity);
+}
+
+/// Decodes `addresses` in parallel into the address cache and returns how many were valid.
+pub fn warm_address_cache(addresses: Vec<String>) -> usize {
+    addresses.par_iter().filter(|address| address_cache().get_or_parse(address).is_some()).count()
+}
+
+// Signing context functions
+pub fn prepare_signing_context() {
+    signing_context();
+}
+
+/// Initializes everything the first account operation would otherwise pay
+/// for. Runs once per process, concurrent and later calls wait for the first
+/// run and return its timings.
+pub fn warm_up() -> ffi::WarmUpTimings {
+    *WARM_UP.get_or_init(|| {
+        let started = Instant::now();
+        let registries_nanos = elapsed_nanos(|| {
+            ensure_private_key_storage();
+            ensure_address_storage();
+            ensure_view_key_storage();
+            ensure_signature_storage();
+            ensure_vanity_search_storage();
+            ensure_stream_storage();
+            derivation_cache();
+            address_cache();
+        });
+        // Between them, key generation, signing and verification touch the generators and every
+        // Poseidon instance that account operations use
+        let network_nanos = elapsed_nanos(|| {
+            let rng = &mut rand::thread_rng();
+            let message = b"warm-up";
+            if let Ok(private_key) = PrivateKey::<CurrentNetwork>::new(rng) {
+                if let (Ok(address), Ok(signature)) = (Address::try_from(&private_key), private_key.sign_bytes(message, rng)) {
+                    signature.verify_bytes(&address, message);
+                }
+            }
+        });
+        let signing_context_nanos = elapsed_nanos(|| {
+            signing_context();
+        });
+        let thread_pool_nanos = elapsed_nanos(|| {
+            rayon::current_num_threads();
+        });
+        ffi::WarmUpTimings {
+            registries_nanos,
+            network_nanos,
+            signing_context_nanos,
+            thread_pool_nanos,
+            total_nanos: started.elapsed().as_nanos() as u64,
+        }
+    })
+}
+
+fn elapsed_nanos(f: impl FnOnce()) -> u64 {
+    let started = Instant::now();
+    f();
+    started.elapsed().as_nanos() as u64
+}
+
+/// Registers the accounts of `private_keys` (key strings packed in the offsets
+/// layout), reading their view keys and addresses from the encrypted cache
+/// file at `path` where it has them. See `disk_cache::restore_accounts` for
+/// the file handling.
+pub fn restore_accounts(path: &str, secret: &[u8], private_keys: &[u8]) -> ffi::RestoreResult {
+    let restored = match unpack_with_offsets(private_keys) {
+        Some(private_keys) => stats::timed(Operation::Batch, || disk_cache::restore_accounts(path, secret, &private_keys)),
+        None => Err("Malformed private key batch".to_string()),
+    };
+    let accounts = match restored {
+        Ok(accounts) => accounts,
+        Err(error) => return ffi::RestoreResult { success: false, accounts: Vec::new(), cached: 0, derived: 0, error },
+    };
+    let cached = accounts.iter().filter(|account| account.cached).count() as u32;
+    let accounts: Vec<ffi::RestoredAccount> = accounts
+        .into_iter()
+        .map(|account| ffi::RestoredAccount {
+            private_key: ffi::PrivateKeyHandle { id: ensure_private_key_storage().insert(SigningKey::new(account.private_key)) },
+            view_key: ffi::ViewKeyHandle { id: ensure_view_key_storage().insert(account.view_key) },
+            address: ffi::AddressHandle { id: ensure_address_storage().insert(account.address) },
+        })
+        .collect();
+    let derived = accounts.len() as u32 - cached;
+    ffi::RestoreResult { success: true, accounts, cached, derived, error: String::new() }
+}
+
+// Vanity search functions
+pub fn vanity_search_new(prefix: String, suffix: String) -> ffi::VanitySearchHandle {
+    match VanitySearch::new(&prefix, &suffix) {
+        Ok(search) => ffi::VanitySearchHandle { id: ensure_vanity_search_storage().insert(search) },
+        Err(_) => ffi::VanitySearchHandle { id: 0 }, // Invalid handle
+    }
+}
+
+// Blocks until the search finds a key (returned as a new private key handle) or is cancelled (id 0)
+pub fn vanity_search_run(handle: &ffi::VanitySearchHandle, threads: usize) -> ffi::PrivateKeyHandle {
+    let found = ensure_vanity_search_storage().get(handle.id).and_then(|search| search.run(signing_context(), threads));
+    match found {
+        Some(private_key) => ffi::PrivateKeyHandle { id: ensure_private_key_storage().insert(SigningKey::new(private_key)) },
+        None => ffi::PrivateKeyHandle { id: 0 }, // Invalid handle
+    }
+}
+
+pub fn vanity_search_progress(handle: &ffi::VanitySearchHandle) -> ffi::VanityProgress {
+    match ensure_vanity_search_storage().get(handle.id) {
+        Some(search) => ffi::VanityProgress { attempts: search.attempts(), elapsed_seconds: search.elapsed_seconds() },
+        None => ffi::VanityProgress { attempts: 0, elapsed_seconds: 0.0 },
+    }
+}
+
+pub fn vanity_search_cancel(handle: &ffi::VanitySearchHandle) {
+    if let Some(search) = ensure_vanity_search_storage().get(handle.id) {
+        search.cancel();
+    }
+}
+
+pub fn destroy_vanity_search(handle: &ffi::VanitySearchHandle) {
+    ensure_vanity_search_storage().remove(handle.id);
+}
+
+// Stream functions
+pub fn stream_new() -> ffi::StreamHandle {
+    ffi::StreamHandle { id: ensure_stream_storage().insert(Mutex::new(Some(StreamHasher::new()))) }
+}
+
+pub fn stream_update(handle: &ffi::StreamHandle, chunk: &[u8]) -> ffi::AccountResult {
+    let Some(stream) = ensure_stream_storage().get(handle.id) else {
+        return error_result("Invalid stream handle".to_string());
+    };
+    let mut stream = stream.lock().unwrap();
+    match stream.as_mut().map(|hasher| hasher.update(chunk)) {
+        Some(Ok(())) => success_result(String::new()),
+        Some(Err(e)) => error_result(format!("Hashing failed: {}", e)),
+        None => error_result("The stream has already been finalized".to_string()),
+    }
+}
+
+// Finishes the stream's hash, so each stream produces a single digest
+fn finish_stream(handle: &ffi::StreamHandle) -> Result<Field<CurrentNetwork>, String> {
+    let stream = ensure_stream_storage().get(handle.id).ok_or("Invalid stream handle")?;
+    let hasher = stream.lock().unwrap().take().ok_or("The stream has already been finalized")?;
+    hasher.finish().map_err(|e| format!("Hashing failed: {}", e))
+}
+
+pub fn stream_sign(handle: &ffi::StreamHandle, private_key: &ffi::PrivateKeyHandle, signature: &mut [u8]) -> ffi::AccountResult {
+    let Some(key) = ensure_private_key_storage().get(private_key.id) else {
+        return error_result("Invalid private key handle".to_string());
+    };
+    if signature.len() != signature_size_in_bytes() {
+        return error_result("Signature buffer has the wrong size".to_string());
+    }
+    let result = finish_stream(handle).and_then(|digest| {
+        stats::timed(Operation::Sign, || {
+            signing_context()
+                .sign_fields(&key, &signed_message(digest), &mut rand::thread_rng())
+                .and_then(|signed| Ok(signed.write_le(signature)?))
+                .map_err(|e| format!("Signing failed: {}", e))
+        })
+    });
+    match result {
+        Ok(()) => success_result(String::new()),
+        Err(e) => error_result(e),
+    }
+}
+
+pub fn stream_verify(handle: &ffi::StreamHandle, address: &ffi::AddressHandle, signature_bytes: &[u8]) -> bool {
+    let (Some(address), Ok(signature)) =
+        (ensure_address_storage().get(address.id), Signature::<CurrentNetwork>::from_bytes_le(signature_bytes))
+    else {
+        return false;
+    };
+    finish_stream(handle)
+        .is_ok_and(|digest| stats::timed(Operation::Verify, || signing_context().verify_fields(&signature, &address, &signed_message(digest))))
+}
+
+pub fn destroy_stream(handle: &ffi::StreamHandle) {
+    ensure_stream_storage().remove(handle.id);
+}
+
+// Stats functions
+pub fn set_stats_enabled(enabled: bool) {
+    stats::set_enabled(enabled);
+}
+
+pub fn stats_enabled() -> bool {
+    stats::enabled()
+}
+
+fn operation_counters(operation: Operation) -> ffi::OperationCounters {
+    let summary = stats::summary(operation);
+    ffi::OperationCounters {
+        count: summary.count,
+        total_nanos: summary.total,
+        p50_nanos: summary.p50,
+        p90_nanos: summary.p90,
+        p99_nanos: summary.p99,
+        max_nanos: summary.max,
+    }
+}
+
+fn registry_counters<T>(registry: &Registry<T>) -> ffi::RegistryCounters {
+    ffi::RegistryCounters { live_handles: registry.len() as u64, lock_wait_nanos: registry.lock_wait_nanos() }
+}
+
+pub fn stats_snapshot() -> ffi::StatsSnapshot {
+    ffi::StatsSnapshot {
+        enabled: stats::enabled(),
+        parse: operation_counters(Operation::Parse),
+        derive: operation_counters(Operation::Derive),
+        sign: operation_counters(Operation::Sign),
+        verify: operation_counters(Operation::Verify),
+        batch: operation_counters(Operation::Batch),
+        marshal: operation_counters(Operation::Marshal),
+        private_keys: registry_counters(ensure_private_key_storage()),
+        addresses: registry_counters(ensure_address_storage()),
+        view_keys: registry_counters(ensure_view_key_storage()),
+        streams: registry_counters(ensure_stream_storage()),
+        vanity_searches: registry_counters(ensure_vanity_search_storage()),
+        bytes_copied: stats::bytes_copied(),
+    }
+}
+
+// Live handle counts are not reset, they always reflect the registries' contents
+pub fn reset_stats() {
+    stats::reset();
+    ensure_private_key_storage().reset_lock_wait();
+    ensure_address_storage().reset_lock_wait();
+    ensure_view_key_storage().reset_lock_wait();
+    ensure_stream_storage().reset_lock_wait();
+    ensure_vanity_search_storage().reset_lock_wait();
+}
+
+// Called by the C++ layer after copying a buffer in or out of the bridge, only while stats are enabled
+pub fn record_marshal(nanos: u64, bytes: u64) {
+    stats::record(Operation::Marshal, nanos);
+    stats::add_bytes_copied(bytes);
 }
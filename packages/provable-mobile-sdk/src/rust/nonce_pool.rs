@@ -0,0 +1,128 @@
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Condvar, Mutex};
+
+use snarkvm_console::{
+    prelude::{FromBytes, ToBytes},
+    types::{Field, Scalar},
+};
+use zeroize::Zeroizing;
+
+use crate::{signing_context, CurrentNetwork};
+
+const NONCE_SIZE: usize = 32;
+// Entries computed outside the lock per refill step, so signers can draw from a refill that is still under way
+const REFILL_BATCH: usize = 4;
+
+struct Entry {
+    nonce: Zeroizing<[u8; NONCE_SIZE]>,
+    commitment: Field<CurrentNetwork>,
+}
+
+struct State {
+    entries: Vec<Entry>,
+    depth: usize,
+    refill_below: usize,
+    refilling: bool,
+}
+
+/// Nonces and their commitments computed ahead of time by a background thread.
+///
+/// The commitment `nonce * G` is the one scalar multiplication in a signature
+/// that depends on neither the key nor the message. Keys cache their compute
+/// key and address after their first signature, so from then on a signer
+/// holding a pooled pair only pays for the challenge hash. Every
+/// pair is removed from the pool when it is taken, so it signs at most one
+/// message. Nonces are stored serialized and zeroized when they are taken or
+/// when the pool is shrunk or disabled. The pool starts disabled;
+/// `configure` with a non-zero depth enables it.
+pub(crate) struct NoncePool {
+    state: Mutex<State>,
+    wake: Condvar,
+    pooled: AtomicU64,
+    inline: AtomicU64,
+}
+
+impl NoncePool {
+    pub(crate) fn new() -> Self {
+        Self {
+            state: Mutex::new(State { entries: Vec::new(), depth: 0, refill_below: 0, refilling: false }),
+            wake: Condvar::new(),
+            pooled: AtomicU64::new(0),
+            inline: AtomicU64::new(0),
+        }
+    }
+
+    /// Keeps up to `depth` pairs ready, topping the pool back up to `depth`
+    /// whenever it falls below `refill_below` (clamped to `1..=depth`). A
+    /// depth of 0 disables the pool and stops its thread.
+    pub(crate) fn configure(&'static self, depth: usize, refill_below: usize) {
+        let mut state = self.state.lock().unwrap();
+        state.depth = depth;
+        state.refill_below = if depth == 0 { 0 } else { refill_below.clamp(1, depth) };
+        state.entries.truncate(depth);
+        if depth == 0 {
+            // Drop the allocation too, the dropped entries have already wiped their nonces
+            state.entries = Vec::new();
+        } else {
+            state.entries.reserve_exact(depth - state.entries.len());
+            if !state.refilling {
+                state.refilling = true;
+                let spawned = std::thread::Builder::new().name("provable-nonce-pool".to_string()).spawn(move || self.refill());
+                state.refilling = spawned.is_ok();
+            }
+        }
+        drop(state);
+        self.wake.notify_all();
+    }
+
+    /// Removes a pair from the pool, or returns `None` while it is empty or disabled.
+    pub(crate) fn take(&self) -> Option<(Scalar<CurrentNetwork>, Field<CurrentNetwork>)> {
+        let mut state = self.state.lock().unwrap();
+        let entry = state.entries.pop();
+        if state.entries.len() < state.refill_below {
+            self.wake.notify_one();
+        }
+        drop(state);
+
+        let counter = if entry.is_some() { &self.pooled } else { &self.inline };
+        counter.fetch_add(1, Ordering::Relaxed);
+        let entry = entry?;
+        Some((Scalar::from_bytes_le(&*entry.nonce).ok()?, entry.commitment))
+    }
+
+    /// Returns `(available, depth, pooled, inline)`, the last two counting
+    /// signatures that took a pooled pair and ones that had to compute their own.
+    pub(crate) fn stats(&self) -> (usize, usize, u64, u64) {
+        let state = self.state.lock().unwrap();
+        (state.entries.len(), state.depth, self.pooled.load(Ordering::Relaxed), self.inline.load(Ordering::Relaxed))
+    }
+
+    // Runs on the pool's thread until the pool is disabled
+    fn refill(&self) {
+        let rng = &mut rand::thread_rng();
+        let mut state = self.state.lock().unwrap();
+        loop {
+            state = self.wake.wait_while(state, |state| state.depth > 0 && state.entries.len() >= state.refill_below).unwrap();
+            // Fill all the way back up once woken, rather than one entry per signature
+            while state.depth > 0 && state.entries.len() < state.depth {
+                let count = (state.depth - state.entries.len()).min(REFILL_BATCH);
+                drop(state);
+                let batch: Vec<Entry> = (0..count).filter_map(|_| Self::entry(rng)).collect();
+                state = self.state.lock().unwrap();
+                let room = state.depth - state.entries.len().min(state.depth);
+                state.entries.extend(batch.into_iter().take(room));
+            }
+            if state.depth == 0 {
+                state.refilling = false;
+                return;
+            }
+        }
+    }
+
+    fn entry(rng: &mut rand::rngs::ThreadRng) -> Option<Entry> {
+        let (nonce, commitment) = signing_context().nonce_commitment(rng);
+        let mut bytes = Zeroizing::new([0u8; NONCE_SIZE]);
+        nonce.write_le(&mut bytes[..]).ok()?;
+        Some(Entry { nonce: bytes, commitment })
+    }
+}
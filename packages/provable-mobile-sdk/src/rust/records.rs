@@ -0,0 +1,76 @@
+use std::str::FromStr;
+
+use rayon::prelude::*;
+use snarkvm_console::{
+    account::ViewKey,
+    network::Network,
+    program::{Ciphertext, Record},
+    types::Field,
+};
+
+/// Finds the record ciphertext strings in `records` owned by `view_key`,
+/// returning each match's index and decrypted record string in input order.
+///
+/// Ownership is checked against the x-coordinate of the view key's address,
+/// which the caller derives once for the whole scan, and only owned records
+/// are decrypted. Entries that are not record ciphertexts are skipped.
+///
+/// The whole batch and its results are held in memory at once. Memory only
+/// stays bounded when callers split long scans into batches, as
+/// `scanRecordChunks` does on the JS side.
+pub fn scan_records<N: Network>(view_key: &ViewKey<N>, address_x: &Field<N>, records: &[&[u8]]) -> Vec<(u32, String)> {
+    records
+        .par_iter()
+        .enumerate()
+        .filter_map(|(index, record)| {
+            let record = Record::<N, Ciphertext<N>>::from_str(std::str::from_utf8(record).ok()?).ok()?;
+            if !record.is_owner_with_address_x_coordinate(view_key, address_x) {
+                return None;
+            }
+            Some((index as u32, record.decrypt(view_key).ok()?.to_string()))
+        })
+        .collect()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use snarkvm_console::{
+        account::{Address, PrivateKey},
+        network::MainnetV0,
+        prelude::Uniform,
+        program::Plaintext,
+        types::Scalar,
+    };
+
+    type CurrentNetwork = MainnetV0;
+
+    fn encrypted_record(owner: &Address<CurrentNetwork>, microcredits: u64) -> (String, String) {
+        let randomizer = Scalar::<CurrentNetwork>::rand(&mut rand::thread_rng());
+        let nonce = CurrentNetwork::g_scalar_multiply(&randomizer);
+        let record = Record::<CurrentNetwork, Plaintext<CurrentNetwork>>::from_str(&format!(
+            "{{ owner: {owner}.private, microcredits: {microcredits}u64.private, _nonce: {nonce}.public }}"
+        ))
+        .unwrap();
+        let ciphertext: Record<CurrentNetwork, Ciphertext<CurrentNetwork>> = record.encrypt(randomizer).unwrap();
+        (ciphertext.to_string(), record.to_string())
+    }
+
+    #[test]
+    fn finds_and_decrypts_owned_records_at_their_index() {
+        let rng = &mut rand::thread_rng();
+        let private_key = PrivateKey::<CurrentNetwork>::new(rng).unwrap();
+        let view_key = ViewKey::try_from(&private_key).unwrap();
+        let address = Address::try_from(&private_key).unwrap();
+        let stranger = Address::try_from(&PrivateKey::<CurrentNetwork>::new(rng).unwrap()).unwrap();
+
+        let (owned_first, plaintext_first) = encrypted_record(&address, 5);
+        let (foreign, _) = encrypted_record(&stranger, 6);
+        let (owned_second, plaintext_second) = encrypted_record(&address, 7);
+        let records = [foreign.as_str(), owned_first.as_str(), "not a record", owned_second.as_str()];
+        let entries: Vec<&[u8]> = records.iter().map(|record| record.as_bytes()).collect();
+
+        let found = scan_records(&view_key, &address.to_x_coordinate(), &entries);
+        assert_eq!(found, [(1, plaintext_first), (3, plaintext_second)]);
+    }
+}
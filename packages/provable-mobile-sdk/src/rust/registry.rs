@@ -0,0 +1,158 @@
+use std::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
+use std::sync::{Arc, RwLock, RwLockReadGuard, RwLockWriteGuard};
+use std::time::Instant;
+
+use crate::stats;
+
+// Handles are packed as `generation << 32 | slot << SHARD_BITS | shard`.
+// Generations start at 1, so a valid handle is never 0.
+const SHARD_BITS: u32 = 6;
+const SHARD_COUNT: usize = 1 << SHARD_BITS;
+const SHARD_MASK: u64 = (SHARD_COUNT as u64) - 1;
+const SLOT_MASK: u64 = (1 << (32 - SHARD_BITS)) - 1;
+
+struct Entry<T> {
+    generation: u32,
+    value: Option<Arc<T>>,
+}
+
+struct Slab<T> {
+    entries: Vec<Entry<T>>,
+    free: Vec<u32>,
+}
+
+impl<T> Slab<T> {
+    const fn new() -> Self {
+        Self { entries: Vec::new(), free: Vec::new() }
+    }
+}
+
+/// Generational slab registry mapping FFI handles to shared objects.
+///
+/// Slots are spread across independent shards, so inserts and lookups from
+/// different threads rarely touch the same lock, and lookups only hold a
+/// shard's read lock long enough to clone the `Arc`. Stale handles are
+/// rejected by the generation check instead of aliasing a reused slot.
+///
+/// While stats are enabled, the time spent blocked on a contended shard is
+/// added to `lock_wait_nanos`; uncontended acquisitions are never timed.
+pub struct Registry<T> {
+    shards: [RwLock<Slab<T>>; SHARD_COUNT],
+    next_shard: AtomicUsize,
+    live: AtomicUsize,
+    lock_wait_nanos: AtomicU64,
+}
+
+impl<T> Registry<T> {
+    pub fn new() -> Self {
+        Self {
+            shards: std::array::from_fn(|_| RwLock::new(Slab::new())),
+            next_shard: AtomicUsize::new(0),
+            live: AtomicUsize::new(0),
+            lock_wait_nanos: AtomicU64::new(0),
+        }
+    }
+
+    pub fn insert(&self, value: T) -> u64 {
+        self.insert_arc(Arc::new(value))
+    }
+
+    pub fn insert_arc(&self, value: Arc<T>) -> u64 {
+        let shard = self.next_shard.fetch_add(1, Ordering::Relaxed) & (SHARD_COUNT - 1);
+        let mut slab = self.write(shard);
+
+        let slot = match slab.free.pop() {
+            Some(slot) => slot,
+            None => {
+                let slot = slab.entries.len() as u32;
+                assert!((slot as u64) <= SLOT_MASK, "registry shard exhausted");
+                slab.entries.push(Entry { generation: 0, value: None });
+                slot
+            }
+        };
+
+        let entry = &mut slab.entries[slot as usize];
+        entry.generation = entry.generation.wrapping_add(1).max(1);
+        entry.value = Some(value);
+        self.live.fetch_add(1, Ordering::Relaxed);
+
+        ((entry.generation as u64) << 32) | ((slot as u64) << SHARD_BITS) | shard as u64
+    }
+
+    pub fn get(&self, id: u64) -> Option<Arc<T>> {
+        let (shard, slot, generation) = Self::decode(id)?;
+        let slab = self.read(shard);
+        slab.entries
+            .get(slot)
+            .filter(|entry| entry.generation == generation)
+            .and_then(|entry| entry.value.clone())
+    }
+
+    pub fn remove(&self, id: u64) -> Option<Arc<T>> {
+        let (shard, slot, generation) = Self::decode(id)?;
+        let mut slab = self.write(shard);
+        let entry = slab.entries.get_mut(slot).filter(|entry| entry.generation == generation)?;
+        let value = entry.value.take()?;
+        slab.free.push(slot as u32);
+        self.live.fetch_sub(1, Ordering::Relaxed);
+        Some(value)
+    }
+
+    pub fn len(&self) -> usize {
+        self.live.load(Ordering::Relaxed)
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    pub fn lock_wait_nanos(&self) -> u64 {
+        self.lock_wait_nanos.load(Ordering::Relaxed)
+    }
+
+    pub fn reset_lock_wait(&self) {
+        self.lock_wait_nanos.store(0, Ordering::Relaxed);
+    }
+
+    fn read(&self, shard: usize) -> RwLockReadGuard<'_, Slab<T>> {
+        if let Ok(slab) = self.shards[shard].try_read() {
+            return slab;
+        }
+        let started = stats::enabled().then(Instant::now);
+        let slab = self.shards[shard].read().unwrap();
+        self.add_lock_wait(started);
+        slab
+    }
+
+    fn write(&self, shard: usize) -> RwLockWriteGuard<'_, Slab<T>> {
+        if let Ok(slab) = self.shards[shard].try_write() {
+            return slab;
+        }
+        let started = stats::enabled().then(Instant::now);
+        let slab = self.shards[shard].write().unwrap();
+        self.add_lock_wait(started);
+        slab
+    }
+
+    fn add_lock_wait(&self, started: Option<Instant>) {
+        if let Some(started) = started {
+            self.lock_wait_nanos.fetch_add(started.elapsed().as_nanos() as u64, Ordering::Relaxed);
+        }
+    }
+
+    fn decode(id: u64) -> Option<(usize, usize, u32)> {
+        let generation = (id >> 32) as u32;
+        if generation == 0 {
+            return None;
+        }
+        let shard = (id & SHARD_MASK) as usize;
+        let slot = ((id >> SHARD_BITS) & SLOT_MASK) as usize;
+        Some((shard, slot, generation))
+    }
+}
+
+impl<T> Default for Registry<T> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
@@ -0,0 +1,99 @@
+use std::cell::RefCell;
+
+use crate::signing::SigningContext;
+use snarkvm_console::{
+    account::{Address, ComputeKey, Signature},
+    network::Network,
+    prelude::{FromBits, FromBytes, SizeInBytes, SizeInDataBits, ToBits},
+    types::Field,
+};
+use zeroize::Zeroize;
+
+// Bit buffers above this size (a 64 KB message) are freed after use instead of kept for the thread's lifetime
+const MAX_RETAINED_BITS: usize = 8 * 64 * 1024;
+
+thread_local! {
+    // Unpacking a message takes one bool per bit, reusing the buffer keeps concurrent signers and verifiers
+    // on different threads (or JS runtimes) from contending on the allocator
+    static MESSAGE_BITS: RefCell<Vec<bool>> = const { RefCell::new(Vec::new()) };
+}
+
+/// Packs message bytes into field elements exactly like `sign_bytes`/`verify_bytes`.
+pub(crate) fn message_to_fields<N: Network>(message: &[u8]) -> Option<Vec<Field<N>>> {
+    let mut fields = Vec::with_capacity(message_field_count::<N>(message.len()));
+    append_message_fields(message, &mut fields).then_some(fields)
+}
+
+/// `message_to_fields` for secret bytes such as a seed, wiping this thread's
+/// bit buffer afterwards instead of leaving the secret's bits in it.
+pub(crate) fn secret_to_fields<N: Network>(secret: &[u8]) -> Option<Vec<Field<N>>> {
+    let fields = message_to_fields(secret);
+    MESSAGE_BITS.with_borrow_mut(|bits| bits.zeroize());
+    fields
+}
+
+/// Appends the packing of `message` to `fields`, so callers can build it into
+/// a reused buffer. Returns `false` if the message could not be encoded.
+pub(crate) fn append_message_fields<N: Network>(message: &[u8], fields: &mut Vec<Field<N>>) -> bool {
+    MESSAGE_BITS.with_borrow_mut(|bits| {
+        bits.clear();
+        message.write_bits_le(bits);
+        let encoded = bits
+            .chunks(Field::<N>::size_in_data_bits())
+            .map(Field::from_bits_le)
+            .try_for_each(|field| field.map(|field| fields.push(field)))
+            .is_ok();
+        if bits.capacity() > MAX_RETAINED_BITS {
+            *bits = Vec::new();
+        }
+        encoded
+    })
+}
+
+/// Appends the field elements packed in `packed`, each in its 32-byte
+/// little-endian `write_le` form, to `fields`. Returns `false` if `packed` is
+/// not a whole number of elements or any element is not below the modulus.
+pub(crate) fn append_packed_fields<N: Network>(packed: &[u8], fields: &mut Vec<Field<N>>) -> bool {
+    let size = Field::<N>::size_in_bytes();
+    packed.len() % size == 0
+        && packed.chunks_exact(size).try_for_each(|bytes| Field::from_bytes_le(bytes).map(|field| fields.push(field))).is_ok()
+}
+
+/// Number of field elements a `length`-byte message packs into.
+pub(crate) fn message_field_count<N: Network>(length: usize) -> usize {
+    (8 * length).div_ceil(Field::<N>::size_in_data_bits())
+}
+
+/// Checks the Schnorr challenge of `signature` over `message` for `address`.
+///
+/// This is `Signature::verify` without the final compute key to address
+/// derivation, which callers check separately with `owns_address` so that it
+/// can be shared by every signature from the same signer.
+pub(crate) fn verify_challenge<N: Network>(
+    context: &SigningContext<N>,
+    signature: &Signature<N>,
+    address: &Address<N>,
+    message: &[Field<N>],
+) -> bool {
+    if message.len() > N::MAX_DATA_SIZE_IN_FIELDS as usize {
+        return false;
+    }
+
+    let pk_sig = signature.compute_key().pk_sig();
+    let pr_sig = signature.compute_key().pr_sig();
+    let g_r = context.g_scalar_multiply_public(&signature.response()) + (pk_sig * signature.challenge());
+
+    let mut preimage = Vec::with_capacity(4 + message.len());
+    preimage.extend([g_r, pk_sig, pr_sig, **address].map(|point| point.to_x_coordinate()));
+    preimage.extend_from_slice(message);
+
+    match N::hash_to_scalar_psd8(&preimage) {
+        Ok(candidate_challenge) => signature.challenge() == candidate_challenge,
+        Err(_) => false,
+    }
+}
+
+/// Returns `true` if `compute_key` derives `address`.
+pub(crate) fn owns_address<N: Network>(context: &SigningContext<N>, compute_key: &ComputeKey<N>, address: &Address<N>) -> bool {
+    context.compute_key_to_address(compute_key) == *address
+}
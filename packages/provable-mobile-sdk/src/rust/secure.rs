@@ -0,0 +1,243 @@
+//! Pooled scratch memory for secret key material.
+//!
+//! The snarkvm `FromStr` and `Display` impls for private and view keys decode
+//! and encode through heap vectors and strings that are freed without being
+//! wiped. The functions here do the same base58 conversions in fixed-size
+//! slots leased from one page-aligned arena, locked into memory where the
+//! platform allows, and wipe each slot when it is released.
+
+use std::alloc::{alloc_zeroed, Layout};
+use std::ops::{Deref, DerefMut};
+use std::ptr::NonNull;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::OnceLock;
+
+use snarkvm_console::{
+    account::{PrivateKey, ViewKey},
+    network::Network,
+    prelude::{FromBytes, ToBytes},
+    types::Field,
+};
+use zeroize::Zeroize;
+
+pub const SLOT_SIZE: usize = 128;
+// One bit of `SecretArena::in_use` per slot
+const SLOT_COUNT: usize = 64;
+const PAGE_SIZE: usize = 4096;
+
+// Decoded "APrivateKey1" and "AViewKey1"
+const PRIVATE_KEY_PREFIX: [u8; 11] = [127, 134, 189, 116, 210, 221, 210, 137, 145, 18, 253];
+const VIEW_KEY_PREFIX: [u8; 7] = [14, 138, 223, 204, 247, 224, 122];
+const KEY_SIZE: usize = 32;
+// Where the base58 digits go while encoding, after the at most 43 bytes being encoded
+const DIGITS_OFFSET: usize = 64;
+
+const BASE58_ALPHABET: &[u8; 58] = b"123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+const INVALID_DIGIT: u8 = u8::MAX;
+
+const BASE58_VALUES: [u8; 128] = {
+    let mut values = [INVALID_DIGIT; 128];
+    let mut i = 0;
+    while i < BASE58_ALPHABET.len() {
+        values[BASE58_ALPHABET[i] as usize] = i as u8;
+        i += 1;
+    }
+    values
+};
+
+static ARENA: OnceLock<SecretArena> = OnceLock::new();
+
+struct SecretArena {
+    memory: NonNull<u8>,
+    in_use: AtomicU64,
+    locked: bool,
+}
+
+// Slots are only reached through the `SecretBuffer` that leased them
+unsafe impl Send for SecretArena {}
+unsafe impl Sync for SecretArena {}
+
+impl SecretArena {
+    fn new() -> Self {
+        let layout = Layout::from_size_align(SLOT_SIZE * SLOT_COUNT, PAGE_SIZE).unwrap();
+        let memory = NonNull::new(unsafe { alloc_zeroed(layout) }).unwrap_or_else(|| std::alloc::handle_alloc_error(layout));
+        // Best effort, it fails once the process reaches its locked memory limit
+        let locked = unsafe { libc::mlock(memory.as_ptr() as *const libc::c_void, layout.size()) } == 0;
+        Self { memory, in_use: AtomicU64::new(0), locked }
+    }
+}
+
+/// Whether the arena's pages are locked into memory, so they are never written to swap.
+pub fn arena_locked() -> bool {
+    ARENA.get_or_init(SecretArena::new).locked
+}
+
+/// A `SLOT_SIZE` byte buffer that is wiped when dropped. It is a slot of the
+/// shared arena, or a heap buffer while every slot is leased.
+pub struct SecretBuffer {
+    bytes: NonNull<[u8; SLOT_SIZE]>,
+    slot: Option<usize>,
+}
+
+unsafe impl Send for SecretBuffer {}
+
+impl SecretBuffer {
+    pub fn lease() -> Self {
+        let arena = ARENA.get_or_init(SecretArena::new);
+        let mut used = arena.in_use.load(Ordering::Relaxed);
+        loop {
+            let slot = (!used).trailing_zeros() as usize;
+            if slot == SLOT_COUNT {
+                return Self { bytes: NonNull::from(Box::leak(Box::new([0u8; SLOT_SIZE]))), slot: None };
+            }
+            match arena.in_use.compare_exchange_weak(used, used | 1 << slot, Ordering::Acquire, Ordering::Relaxed) {
+                Ok(_) => {
+                    let bytes = unsafe { arena.memory.as_ptr().add(slot * SLOT_SIZE) } as *mut [u8; SLOT_SIZE];
+                    return Self { bytes: NonNull::new(bytes).unwrap(), slot: Some(slot) };
+                }
+                Err(current) => used = current,
+            }
+        }
+    }
+}
+
+impl Deref for SecretBuffer {
+    type Target = [u8; SLOT_SIZE];
+
+    fn deref(&self) -> &Self::Target {
+        unsafe { self.bytes.as_ref() }
+    }
+}
+
+impl DerefMut for SecretBuffer {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        unsafe { self.bytes.as_mut() }
+    }
+}
+
+impl Drop for SecretBuffer {
+    fn drop(&mut self) {
+        self.zeroize();
+        match self.slot {
+            Some(slot) => {
+                ARENA.get().unwrap().in_use.fetch_and(!(1 << slot), Ordering::Release);
+            }
+            None => drop(unsafe { Box::from_raw(self.bytes.as_ptr()) }),
+        }
+    }
+}
+
+/// A key string formatted into a `SecretBuffer`, wiped with it when dropped.
+pub struct SecretString {
+    buffer: SecretBuffer,
+    len: usize,
+}
+
+impl SecretString {
+    pub fn private_key<N: Network>(private_key: &PrivateKey<N>) -> Option<Self> {
+        Self::write(|out| write_private_key(private_key, out))
+    }
+
+    pub fn view_key<N: Network>(view_key: &ViewKey<N>) -> Option<Self> {
+        Self::write(|out| write_view_key(view_key, out))
+    }
+
+    fn write(write: impl FnOnce(&mut [u8]) -> Option<usize>) -> Option<Self> {
+        let mut buffer = SecretBuffer::lease();
+        let len = write(&mut buffer[..])?;
+        Some(Self { buffer, len })
+    }
+}
+
+impl AsRef<[u8]> for SecretString {
+    fn as_ref(&self) -> &[u8] {
+        &self.buffer[..self.len]
+    }
+}
+
+/// Parses a private key string, accepting exactly what `PrivateKey::from_str` does.
+pub fn parse_private_key<N: Network>(string: &str) -> Option<PrivateKey<N>> {
+    parse_key(string, &PRIVATE_KEY_PREFIX, |bytes| PrivateKey::try_from(Field::<N>::from_bytes_le(bytes).ok()?).ok())
+}
+
+/// Parses a view key string, accepting exactly what `ViewKey::from_str` does.
+pub fn parse_view_key<N: Network>(string: &str) -> Option<ViewKey<N>> {
+    parse_key(string, &VIEW_KEY_PREFIX, |bytes| ViewKey::from_bytes_le(bytes).ok())
+}
+
+/// Writes the string form of `private_key` into `out` and returns its length,
+/// or `None` when `out` is too small.
+pub fn write_private_key<N: Network>(private_key: &PrivateKey<N>, out: &mut [u8]) -> Option<usize> {
+    write_key(&PRIVATE_KEY_PREFIX, |bytes| private_key.seed().write_le(bytes).ok(), out)
+}
+
+/// `write_private_key` for view keys.
+pub fn write_view_key<N: Network>(view_key: &ViewKey<N>, out: &mut [u8]) -> Option<usize> {
+    write_key(&VIEW_KEY_PREFIX, |bytes| view_key.write_le(bytes).ok(), out)
+}
+
+fn parse_key<T>(string: &str, prefix: &[u8], read: impl FnOnce(&[u8]) -> Option<T>) -> Option<T> {
+    let mut buffer = SecretBuffer::lease();
+    let data = &mut buffer[..prefix.len() + KEY_SIZE];
+    if !decode_base58(string.as_bytes(), data) || &data[..prefix.len()] != prefix {
+        return None;
+    }
+    read(&data[prefix.len()..])
+}
+
+fn write_key(prefix: &[u8], write: impl FnOnce(&mut [u8]) -> Option<()>, out: &mut [u8]) -> Option<usize> {
+    let mut buffer = SecretBuffer::lease();
+    let (data, digits) = buffer.split_at_mut(DIGITS_OFFSET);
+    data[..prefix.len()].copy_from_slice(prefix);
+    write(&mut data[prefix.len()..prefix.len() + KEY_SIZE])?;
+    encode_base58(&data[..prefix.len() + KEY_SIZE], digits, out)
+}
+
+// Decodes base58 `input` into `out`, succeeding only when it decodes to
+// exactly `out.len()` bytes. Each leading '1' stands for a leading zero byte
+fn decode_base58(input: &[u8], out: &mut [u8]) -> bool {
+    out.fill(0);
+    for &c in input {
+        let value = BASE58_VALUES.get(c as usize).copied().unwrap_or(INVALID_DIGIT);
+        if value == INVALID_DIGIT {
+            return false;
+        }
+        let mut carry = value as u32;
+        for byte in out.iter_mut().rev() {
+            carry += *byte as u32 * 58;
+            *byte = carry as u8;
+            carry >>= 8;
+        }
+        if carry != 0 {
+            return false;
+        }
+    }
+    let zeros = input.iter().take_while(|&&c| c == b'1').count();
+    out.iter().take_while(|&&byte| byte == 0).count() == zeros
+}
+
+// Encodes `data` as base58 into `out`, using `digits` for the little-endian
+// base58 digits, and returns the encoded length
+fn encode_base58(data: &[u8], digits: &mut [u8], out: &mut [u8]) -> Option<usize> {
+    let mut len = 0;
+    for &byte in data {
+        let mut carry = byte as u32;
+        for digit in &mut digits[..len] {
+            carry += (*digit as u32) << 8;
+            *digit = (carry % 58) as u8;
+            carry /= 58;
+        }
+        while carry > 0 {
+            *digits.get_mut(len)? = (carry % 58) as u8;
+            len += 1;
+            carry /= 58;
+        }
+    }
+    let zeros = data.iter().take_while(|&&byte| byte == 0).count();
+    let (ones, rest) = out.get_mut(..zeros + len)?.split_at_mut(zeros);
+    ones.fill(b'1');
+    for (c, &digit) in rest.iter_mut().zip(digits[..len].iter().rev()) {
+        *c = BASE58_ALPHABET[digit as usize];
+    }
+    Some(zeros + len)
+}
@@ -0,0 +1,268 @@
+use std::marker::PhantomData;
+use std::sync::OnceLock;
+
+use snarkvm_console::{
+    account::{Address, ComputeKey, PrivateKey, Signature, ViewKey},
+    network::Network,
+    prelude::{bail, CryptoRng, Double, FromBytes, One, Result, Rng, SizeInBits, ToBits, ToBytes, Uniform, Zero},
+    types::{Field, Group, Scalar},
+};
+
+use crate::schnorr::{append_message_fields, message_to_fields, verify_challenge};
+
+// Each window covers 6 scalar bits, so a 251-bit scalar costs 42 additions
+// instead of one per set bit, for a table of 42 * 64 points (~170 KB)
+const WINDOW_BITS: usize = 6;
+const FIELD_SIZE: usize = 32;
+// Table points are stored as their affine x and y coordinates, little-endian
+const POINT_SIZE: usize = 2 * FIELD_SIZE;
+
+/// A private key with its compute key and address, derived on first use.
+///
+/// Every signature hashes the signer's compute key and address into its
+/// challenge. Deriving them takes three generator multiplications, more
+/// than the rest of a signature whose nonce comes from the pool, so a key
+/// kept for repeated signing derives them once instead of per signature.
+pub struct SigningKey<N: Network> {
+    private_key: PrivateKey<N>,
+    public: OnceLock<(ComputeKey<N>, Address<N>)>,
+}
+
+impl<N: Network> SigningKey<N> {
+    pub fn new(private_key: PrivateKey<N>) -> Self {
+        Self { private_key, public: OnceLock::new() }
+    }
+
+    pub fn private_key(&self) -> &PrivateKey<N> {
+        &self.private_key
+    }
+}
+
+/// Windowed precomputation of the network's signing generator.
+///
+/// Row `i` holds `j * 2^(WINDOW_BITS * i) * G` for every `j` in the window,
+/// so a fixed-base multiplication is a single table lookup and addition per
+/// window. The table is built once per process and shared by signing, key
+/// derivation and verification.
+pub struct SigningContext<N: Network> {
+    windows: Vec<Vec<[u8; POINT_SIZE]>>,
+    _network: PhantomData<N>,
+}
+
+impl<N: Network> SigningContext<N> {
+    pub fn new() -> Self {
+        let window_count = Scalar::<N>::size_in_bits().div_ceil(WINDOW_BITS);
+        let mut base = N::g_scalar_multiply(&Scalar::one());
+        let mut windows = Vec::with_capacity(window_count);
+        for _ in 0..window_count {
+            let mut row = Vec::with_capacity(1 << WINDOW_BITS);
+            let mut point = Group::<N>::zero();
+            for _ in 0..1 << WINDOW_BITS {
+                row.push(point_to_bytes(&point));
+                point = point + base;
+            }
+            for _ in 0..WINDOW_BITS {
+                base = base.double();
+            }
+            windows.push(row);
+        }
+        Self { windows, _network: PhantomData }
+    }
+
+    /// Returns `scalar * G`, equal to `N::g_scalar_multiply(scalar)`.
+    ///
+    /// Every window reads its whole row and keeps the entry it needs with a
+    /// mask, then adds it even when it is the identity, so neither the
+    /// branches taken nor the memory read depend on the scalar. Key
+    /// derivation and signing nonces go through here.
+    pub fn g_scalar_multiply(&self, scalar: &Scalar<N>) -> Group<N> {
+        scalar.to_bits_le().chunks(WINDOW_BITS).zip(&self.windows).fold(Group::zero(), |acc, (bits, row)| {
+            let index = window_index(bits);
+            let mut selected = [0u8; POINT_SIZE];
+            for (j, entry) in row.iter().enumerate() {
+                let mask = equal_mask(j, index);
+                for (byte, value) in selected.iter_mut().zip(entry) {
+                    *byte |= value & mask;
+                }
+            }
+            acc + point_from_bytes(&selected)
+        })
+    }
+
+    /// Same result as `g_scalar_multiply`, reading only the entries it needs
+    /// and skipping zero windows. Its timing depends on the scalar, so it is
+    /// only for public scalars, like signature responses and the `sk_prf` of
+    /// a compute key.
+    pub fn g_scalar_multiply_public(&self, scalar: &Scalar<N>) -> Group<N> {
+        scalar.to_bits_le().chunks(WINDOW_BITS).zip(&self.windows).fold(Group::zero(), |acc, (bits, row)| {
+            let index = window_index(bits);
+            if index == 0 { acc } else { acc + point_from_bytes(&row[index]) }
+        })
+    }
+
+    pub fn compute_key(&self, private_key: &PrivateKey<N>) -> Result<ComputeKey<N>> {
+        let pk_sig = self.g_scalar_multiply(&private_key.sk_sig());
+        let pr_sig = self.g_scalar_multiply(&private_key.r_sig());
+        ComputeKey::try_from((pk_sig, pr_sig))
+    }
+
+    pub fn compute_key_to_address(&self, compute_key: &ComputeKey<N>) -> Address<N> {
+        // `sk_prf` is a hash of the compute key's public points
+        Address::new(compute_key.pk_sig() + compute_key.pr_sig() + self.g_scalar_multiply_public(&compute_key.sk_prf()))
+    }
+
+    pub fn address(&self, private_key: &PrivateKey<N>) -> Result<Address<N>> {
+        Ok(self.compute_key_to_address(&self.compute_key(private_key)?))
+    }
+
+    pub fn view_key(&self, private_key: &PrivateKey<N>) -> Result<ViewKey<N>> {
+        let compute_key = self.compute_key(private_key)?;
+        Ok(ViewKey::from_scalar(private_key.sk_sig() + private_key.r_sig() + compute_key.sk_prf()))
+    }
+
+    pub fn view_key_to_address(&self, view_key: &ViewKey<N>) -> Address<N> {
+        Address::new(self.g_scalar_multiply(view_key))
+    }
+
+    /// Same signature scheme as `PrivateKey::sign_bytes`, with every generator
+    /// multiplication going through the table.
+    pub fn sign_bytes<R: Rng + CryptoRng>(&self, key: &SigningKey<N>, message: &[u8], rng: &mut R) -> Result<Signature<N>> {
+        self.sign_bytes_with(key, message, &mut Vec::new(), rng)
+    }
+
+    /// Same as `sign_bytes`, building the hash preimage in `preimage` so that
+    /// a caller reusing the buffer signs without allocating once it has grown
+    /// to fit its largest message.
+    pub fn sign_bytes_with<R: Rng + CryptoRng>(
+        &self,
+        key: &SigningKey<N>,
+        message: &[u8],
+        preimage: &mut Vec<Field<N>>,
+        rng: &mut R,
+    ) -> Result<Signature<N>> {
+        let (nonce, commitment) = self.nonce_commitment(rng);
+        self.sign_bytes_with_nonce(key, message, preimage, nonce, commitment)
+    }
+
+    /// Draws a signing nonce and returns it with the x-coordinate of its
+    /// commitment `nonce * G`, the only part of signing that doesn't depend on
+    /// the key or message. Each pair must sign at most one message, reusing a
+    /// nonce reveals the private key.
+    pub fn nonce_commitment<R: Rng + CryptoRng>(&self, rng: &mut R) -> (Scalar<N>, Field<N>) {
+        let nonce = Scalar::rand(rng);
+        (nonce, self.g_scalar_multiply(&nonce).to_x_coordinate())
+    }
+
+    /// Same as `sign_bytes_with`, using a pair from `nonce_commitment`.
+    pub fn sign_bytes_with_nonce(
+        &self,
+        key: &SigningKey<N>,
+        message: &[u8],
+        preimage: &mut Vec<Field<N>>,
+        nonce: Scalar<N>,
+        commitment: Field<N>,
+    ) -> Result<Signature<N>> {
+        preimage.clear();
+        preimage.resize(4, Field::zero());
+        if !append_message_fields(message, preimage) {
+            bail!("Failed to encode the message as field elements");
+        }
+        self.sign_preimage(key, preimage, nonce, commitment)
+    }
+
+    /// Same signature scheme as `PrivateKey::sign`.
+    pub fn sign_fields<R: Rng + CryptoRng>(&self, key: &SigningKey<N>, message: &[Field<N>], rng: &mut R) -> Result<Signature<N>> {
+        let (nonce, commitment) = self.nonce_commitment(rng);
+        self.sign_fields_with_nonce(key, message, &mut Vec::with_capacity(4 + message.len()), nonce, commitment)
+    }
+
+    /// Same as `sign_bytes_with_nonce` for a message that is already field
+    /// elements, skipping the byte to bit expansion. A byte message signed
+    /// this way after `message_to_fields` gets a signature `verify_bytes` accepts.
+    pub fn sign_fields_with_nonce(
+        &self,
+        key: &SigningKey<N>,
+        message: &[Field<N>],
+        preimage: &mut Vec<Field<N>>,
+        nonce: Scalar<N>,
+        commitment: Field<N>,
+    ) -> Result<Signature<N>> {
+        preimage.clear();
+        preimage.resize(4, Field::zero());
+        preimage.extend_from_slice(message);
+        self.sign_preimage(key, preimage, nonce, commitment)
+    }
+
+    // `preimage` is four placeholder fields followed by the message, the
+    // placeholders are overwritten with the nonce commitment, compute key and address
+    fn sign_preimage(
+        &self,
+        key: &SigningKey<N>,
+        preimage: &mut [Field<N>],
+        nonce: Scalar<N>,
+        commitment: Field<N>,
+    ) -> Result<Signature<N>> {
+        if preimage.len() - 4 > N::MAX_DATA_SIZE_IN_FIELDS as usize {
+            bail!("Cannot sign the message: the message exceeds maximum allowed size");
+        }
+
+        let (compute_key, address) = self.public_keys(key)?;
+        preimage[0] = commitment;
+        preimage[1..4].copy_from_slice(&[compute_key.pk_sig(), compute_key.pr_sig(), **address].map(|point| point.to_x_coordinate()));
+
+        let challenge = N::hash_to_scalar_psd8(preimage)?;
+        let response = nonce - (challenge * key.private_key.sk_sig());
+        Ok(Signature::from((challenge, response, *compute_key)))
+    }
+
+    // Concurrent first signatures with a key may both derive its compute key and address, they store the same values
+    fn public_keys<'a>(&self, key: &'a SigningKey<N>) -> Result<&'a (ComputeKey<N>, Address<N>)> {
+        if let Some(public) = key.public.get() {
+            return Ok(public);
+        }
+        let compute_key = self.compute_key(&key.private_key)?;
+        let address = self.compute_key_to_address(&compute_key);
+        Ok(key.public.get_or_init(|| (compute_key, address)))
+    }
+
+    /// Same result as `Signature::verify_bytes`.
+    pub fn verify_bytes(&self, signature: &Signature<N>, address: &Address<N>, message: &[u8]) -> bool {
+        message_to_fields(message).is_some_and(|message| self.verify_fields(signature, address, &message))
+    }
+
+    /// Same result as `Signature::verify`.
+    pub fn verify_fields(&self, signature: &Signature<N>, address: &Address<N>, message: &[Field<N>]) -> bool {
+        verify_challenge(self, signature, address, message) && self.compute_key_to_address(&signature.compute_key()) == *address
+    }
+}
+
+impl<N: Network> Default for SigningContext<N> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+fn window_index(bits: &[bool]) -> usize {
+    bits.iter().rev().fold(0usize, |index, bit| (index << 1) | *bit as usize)
+}
+
+// 0xff when `a == b` and 0 otherwise, without a branch on either
+fn equal_mask(a: usize, b: usize) -> u8 {
+    let difference = std::hint::black_box((a ^ b) as u64);
+    ((difference.wrapping_sub(1) >> 63) as u8).wrapping_neg()
+}
+
+fn point_to_bytes<N: Network>(point: &Group<N>) -> [u8; POINT_SIZE] {
+    let mut bytes = [0u8; POINT_SIZE];
+    let (x, y) = bytes.split_at_mut(FIELD_SIZE);
+    point.to_x_coordinate().write_le(x).unwrap();
+    point.to_y_coordinate().write_le(y).unwrap();
+    bytes
+}
+
+// Table entries were written by `point_to_bytes`, so they always decode to a point in the subgroup
+fn point_from_bytes<N: Network>(bytes: &[u8; POINT_SIZE]) -> Group<N> {
+    let x = Field::from_bytes_le(&bytes[..FIELD_SIZE]).unwrap();
+    let y = Field::from_bytes_le(&bytes[FIELD_SIZE..]).unwrap();
+    Group::from_xy_coordinates_unchecked(x, y)
+}
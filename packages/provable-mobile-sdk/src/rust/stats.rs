@@ -0,0 +1,162 @@
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use std::time::Instant;
+
+// Each power of two is split into 4 linear sub-buckets, so a percentile read
+// from the histogram is within 25% of the true latency
+const SUB_BUCKET_BITS: u32 = 2;
+const BUCKET_COUNT: usize = (64 << SUB_BUCKET_BITS) as usize;
+
+static ENABLED: AtomicBool = AtomicBool::new(false);
+static BYTES_COPIED: AtomicU64 = AtomicU64::new(0);
+static HISTOGRAMS: [Histogram; OPERATION_COUNT] = [const { Histogram::new() }; OPERATION_COUNT];
+
+const OPERATION_COUNT: usize = 6;
+
+#[derive(Clone, Copy)]
+pub(crate) enum Operation {
+    Parse,
+    Derive,
+    Sign,
+    Verify,
+    // Whole batch calls - the signatures inside a batch are also counted under `Sign`
+    Batch,
+    // Copies between JS buffers and the bridge, reported by the C++ layer
+    Marshal,
+}
+
+/// Latency summary of one operation kind, in nanoseconds.
+pub(crate) struct Summary {
+    pub count: u64,
+    pub total: u64,
+    pub p50: u64,
+    pub p90: u64,
+    pub p99: u64,
+    pub max: u64,
+}
+
+struct Histogram {
+    count: AtomicU64,
+    total: AtomicU64,
+    max: AtomicU64,
+    buckets: [AtomicU64; BUCKET_COUNT],
+}
+
+impl Histogram {
+    const fn new() -> Self {
+        Self {
+            count: AtomicU64::new(0),
+            total: AtomicU64::new(0),
+            max: AtomicU64::new(0),
+            buckets: [const { AtomicU64::new(0) }; BUCKET_COUNT],
+        }
+    }
+
+    fn record(&self, nanos: u64) {
+        self.count.fetch_add(1, Ordering::Relaxed);
+        self.total.fetch_add(nanos, Ordering::Relaxed);
+        self.max.fetch_max(nanos, Ordering::Relaxed);
+        self.buckets[bucket_index(nanos)].fetch_add(1, Ordering::Relaxed);
+    }
+
+    fn summary(&self) -> Summary {
+        let counts: Vec<u64> = self.buckets.iter().map(|bucket| bucket.load(Ordering::Relaxed)).collect();
+        let max = self.max.load(Ordering::Relaxed);
+        let percentile = |p: f64| {
+            let total: u64 = counts.iter().sum();
+            let rank = ((total as f64 * p).ceil() as u64).max(1);
+            let mut seen = 0;
+            for (index, count) in counts.iter().enumerate() {
+                seen += count;
+                if seen >= rank {
+                    return bucket_upper_bound(index).min(max);
+                }
+            }
+            max
+        };
+        Summary {
+            count: self.count.load(Ordering::Relaxed),
+            total: self.total.load(Ordering::Relaxed),
+            p50: percentile(0.5),
+            p90: percentile(0.9),
+            p99: percentile(0.99),
+            max,
+        }
+    }
+
+    fn reset(&self) {
+        self.count.store(0, Ordering::Relaxed);
+        self.total.store(0, Ordering::Relaxed);
+        self.max.store(0, Ordering::Relaxed);
+        for bucket in &self.buckets {
+            bucket.store(0, Ordering::Relaxed);
+        }
+    }
+}
+
+// Values below 2^SUB_BUCKET_BITS get a bucket each, larger ones are indexed by
+// their leading bit and the SUB_BUCKET_BITS bits after it
+fn bucket_index(nanos: u64) -> usize {
+    let sub_buckets = 1u64 << SUB_BUCKET_BITS;
+    if nanos < sub_buckets {
+        return nanos as usize;
+    }
+    let exponent = 63 - nanos.leading_zeros();
+    let mantissa = (nanos >> (exponent - SUB_BUCKET_BITS)) & (sub_buckets - 1);
+    (((exponent - SUB_BUCKET_BITS + 1) as u64) << SUB_BUCKET_BITS | mantissa) as usize
+}
+
+fn bucket_upper_bound(index: usize) -> u64 {
+    let sub_buckets = 1usize << SUB_BUCKET_BITS;
+    if index < sub_buckets {
+        return index as u64;
+    }
+    let shift = (index >> SUB_BUCKET_BITS) as u32 - 1;
+    let mantissa = (sub_buckets | (index & (sub_buckets - 1))) as u128;
+    (((mantissa + 1) << shift) - 1).min(u64::MAX as u128) as u64
+}
+
+/// Whether operations are being recorded. Recording is off by default, and
+/// while it is off every hook costs a single relaxed load.
+pub(crate) fn enabled() -> bool {
+    ENABLED.load(Ordering::Relaxed)
+}
+
+pub(crate) fn set_enabled(enabled: bool) {
+    ENABLED.store(enabled, Ordering::Relaxed);
+}
+
+/// Runs `f`, recording its latency under `operation` if stats are enabled.
+pub(crate) fn timed<T>(operation: Operation, f: impl FnOnce() -> T) -> T {
+    if !enabled() {
+        return f();
+    }
+    let started = Instant::now();
+    let result = f();
+    record(operation, started.elapsed().as_nanos() as u64);
+    result
+}
+
+pub(crate) fn record(operation: Operation, nanos: u64) {
+    HISTOGRAMS[operation as usize].record(nanos);
+}
+
+pub(crate) fn add_bytes_copied(bytes: u64) {
+    BYTES_COPIED.fetch_add(bytes, Ordering::Relaxed);
+}
+
+pub(crate) fn bytes_copied() -> u64 {
+    BYTES_COPIED.load(Ordering::Relaxed)
+}
+
+pub(crate) fn summary(operation: Operation) -> Summary {
+    HISTOGRAMS[operation as usize].summary()
+}
+
+/// Clears the latency histograms and byte counter. Registry lock wait times
+/// are reset by the registries themselves.
+pub(crate) fn reset() {
+    for histogram in &HISTOGRAMS {
+        histogram.reset();
+    }
+    BYTES_COPIED.store(0, Ordering::Relaxed);
+}
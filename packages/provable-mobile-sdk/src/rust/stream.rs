@@ -0,0 +1,93 @@
+use snarkvm_console::{
+    network::Network,
+    prelude::{FromBytes, One, Result},
+    types::Field,
+};
+
+// Each field element absorbs 31 bytes, which keeps chunks byte aligned and
+// below the field modulus, and each Poseidon call absorbs a block of 256 of them
+const BYTES_PER_FIELD: usize = 31;
+const FIELDS_PER_BLOCK: usize = 256;
+const BLOCK_SIZE: usize = BYTES_PER_FIELD * FIELDS_PER_BLOCK;
+
+/// The message a stream signature covers: a marker field, then the digest.
+///
+/// The marker is the largest field element. Byte messages pack 252 data bits
+/// into each field, so no byte message packs into the marker, and the bridge
+/// refuses field messages that start with it. No other signature the SDK
+/// produces can therefore pass as a stream signature, or the other way round.
+pub fn signed_message<N: Network>(digest: Field<N>) -> [Field<N>; 2] {
+    [stream_marker(), digest]
+}
+
+/// Whether a field message starts with the marker reserved for stream signatures.
+pub fn is_stream_message<N: Network>(message: &[Field<N>]) -> bool {
+    message.first() == Some(&stream_marker())
+}
+
+fn stream_marker<N: Network>() -> Field<N> {
+    -Field::one()
+}
+
+/// Incremental hash of an arbitrarily long byte stream into a single field.
+///
+/// The state is chained through Poseidon one block at a time, so memory stays
+/// at one block no matter how much is absorbed, and the total length is bound
+/// into the final hash so a trailing partial block can't be confused with a
+/// zero-padded one. Streamed messages are signed as `signed_message(finish())`,
+/// which is why their signatures don't verify against the raw bytes with
+/// `verify_bytes`.
+pub struct StreamHasher<N: Network> {
+    state: Field<N>,
+    block: Vec<u8>,
+    length: u64,
+}
+
+impl<N: Network> StreamHasher<N> {
+    pub fn new() -> Self {
+        Self {
+            state: Field::new_domain_separator("ProvableMobileSdkStream"),
+            block: Vec::with_capacity(BLOCK_SIZE),
+            length: 0,
+        }
+    }
+
+    pub fn update(&mut self, mut bytes: &[u8]) -> Result<()> {
+        self.length += bytes.len() as u64;
+        while !bytes.is_empty() {
+            let take = (BLOCK_SIZE - self.block.len()).min(bytes.len());
+            self.block.extend_from_slice(&bytes[..take]);
+            bytes = &bytes[take..];
+            if self.block.len() == BLOCK_SIZE {
+                self.absorb()?;
+            }
+        }
+        Ok(())
+    }
+
+    pub fn finish(mut self) -> Result<Field<N>> {
+        if !self.block.is_empty() {
+            self.absorb()?;
+        }
+        N::hash_psd2(&[self.state, Field::from_u64(self.length)])
+    }
+
+    fn absorb(&mut self) -> Result<()> {
+        let mut input = Vec::with_capacity(1 + FIELDS_PER_BLOCK);
+        input.push(self.state);
+        for chunk in self.block.chunks(BYTES_PER_FIELD) {
+            let mut bytes = [0u8; 32];
+            bytes[..chunk.len()].copy_from_slice(chunk);
+            input.push(Field::from_bytes_le(&bytes)?);
+        }
+        self.state = N::hash_psd8(&input)?;
+        self.block.clear();
+        Ok(())
+    }
+}
+
+impl<N: Network> Default for StreamHasher<N> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
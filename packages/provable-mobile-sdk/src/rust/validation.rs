@@ -0,0 +1,173 @@
+use std::str::FromStr;
+
+use rayon::prelude::*;
+use snarkvm_console::account::Address;
+
+use crate::batch::{to_bitmap, unpack_with_offsets};
+use crate::secure::{parse_private_key, parse_view_key};
+use crate::signing::SigningKey;
+use crate::stats::{self, Operation};
+use crate::{ensure_address_storage, ensure_private_key_storage, ensure_view_key_storage, ffi, CurrentNetwork};
+
+const ADDRESS_HRP: &[u8] = b"aleo";
+// "aleo1", 52 characters for the 32-byte point and a 6 character checksum
+const ADDRESS_LENGTH: usize = 63;
+const PRIVATE_KEY_PREFIX: &[u8] = b"APrivateKey1";
+const VIEW_KEY_PREFIX: &[u8] = b"AViewKey1";
+
+const BECH32_CHARSET: &[u8; 32] = b"qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+const BECH32M_CONSTANT: u32 = 0x2bc830a3;
+
+// Position of each (lowercase) character in the bech32 charset
+const BECH32_VALUES: [u8; 128] = {
+    let mut values = [0u8; 128];
+    let mut i = 0;
+    while i < BECH32_CHARSET.len() {
+        values[BECH32_CHARSET[i] as usize] = i as u8;
+        i += 1;
+    }
+    values
+};
+
+// Checksum state after the expanded human-readable part, shared by every address
+const ADDRESS_HRP_CHECKSUM: u32 = {
+    let mut checksum = 1;
+    let mut i = 0;
+    while i < ADDRESS_HRP.len() {
+        checksum = polymod_step(checksum, ADDRESS_HRP[i] >> 5);
+        i += 1;
+    }
+    checksum = polymod_step(checksum, 0);
+    let mut i = 0;
+    while i < ADDRESS_HRP.len() {
+        checksum = polymod_step(checksum, ADDRESS_HRP[i] & 31);
+        i += 1;
+    }
+    checksum
+};
+
+/// Validates packed address strings (offsets layout) and returns a bitmap
+/// with bit `i` (LSB first) set when entry `i` is a valid address.
+///
+/// Entries with the wrong length, prefix, characters or bech32m checksum are
+/// rejected without decoding, so only the survivors pay for the curve point
+/// check, which runs in parallel. With `parse`, each valid address is also
+/// registered and its handle returned in entry order.
+pub fn validate_addresses(packed: &[u8], parse: bool) -> ffi::ValidationResult {
+    stats::timed(Operation::Batch, || {
+        validate(packed, parse, is_plausible_address, Address::<CurrentNetwork>::from_str, |address| {
+            ensure_address_storage().insert(address)
+        })
+    })
+}
+
+/// `validate_addresses` for private key strings.
+pub fn validate_private_keys(packed: &[u8], parse: bool) -> ffi::ValidationResult {
+    stats::timed(Operation::Batch, || {
+        validate(
+            packed,
+            parse,
+            |entry| is_plausible_key(entry, PRIVATE_KEY_PREFIX),
+            |string| parse_private_key::<CurrentNetwork>(string).ok_or(()),
+            |private_key| ensure_private_key_storage().insert(SigningKey::new(private_key)),
+        )
+    })
+}
+
+/// `validate_addresses` for view key strings.
+pub fn validate_view_keys(packed: &[u8], parse: bool) -> ffi::ValidationResult {
+    stats::timed(Operation::Batch, || {
+        validate(
+            packed,
+            parse,
+            |entry| is_plausible_key(entry, VIEW_KEY_PREFIX),
+            |string| parse_view_key::<CurrentNetwork>(string).ok_or(()),
+            |view_key| ensure_view_key_storage().insert(view_key),
+        )
+    })
+}
+
+fn validate<T: Send, E>(
+    packed: &[u8],
+    parse: bool,
+    plausible: impl Fn(&[u8]) -> bool,
+    decode: impl Fn(&str) -> Result<T, E> + Sync,
+    insert: impl Fn(T) -> u64 + Sync,
+) -> ffi::ValidationResult {
+    let Some(entries) = unpack_with_offsets(packed) else {
+        return ffi::ValidationResult {
+            success: false,
+            bitmap: Vec::new(),
+            handles: Vec::new(),
+            error: "Malformed string batch".to_string(),
+        };
+    };
+
+    let survivors: Vec<usize> = (0..entries.len()).filter(|&i| plausible(entries[i])).collect();
+    let decoded: Vec<Option<u64>> = survivors
+        .par_iter()
+        .map(|&i| {
+            let value = decode(std::str::from_utf8(entries[i]).ok()?).ok()?;
+            Some(if parse { insert(value) } else { 0 })
+        })
+        .collect();
+
+    let mut valid = vec![false; entries.len()];
+    let mut handles = Vec::new();
+    for (&i, handle) in survivors.iter().zip(decoded) {
+        if let Some(handle) = handle {
+            valid[i] = true;
+            if parse {
+                handles.push(handle);
+            }
+        }
+    }
+    ffi::ValidationResult { success: true, bitmap: to_bitmap(&valid), handles, error: String::new() }
+}
+
+// Everything `Address::from_str` checks before decoding the point. Case is
+// ignored here, mixed-case strings are left for the full decode to reject
+fn is_plausible_address(entry: &[u8]) -> bool {
+    if entry.len() != ADDRESS_LENGTH
+        || !entry[..ADDRESS_HRP.len()].eq_ignore_ascii_case(ADDRESS_HRP)
+        || entry[ADDRESS_HRP.len()] != b'1'
+    {
+        return false;
+    }
+    let data = &entry[ADDRESS_HRP.len() + 1..];
+    // Fold without short-circuiting, so the charset test compiles to vector compares
+    data.iter().fold(true, |valid, &c| valid & is_bech32_char(c))
+        && data.iter().fold(ADDRESS_HRP_CHECKSUM, |checksum, &c| polymod_step(checksum, BECH32_VALUES[(c | 0x20) as usize]))
+            == BECH32M_CONSTANT
+}
+
+// The private and view key encodings are base58 throughout, so this only
+// rules out a wrong prefix or stray characters, the decode checks the rest
+fn is_plausible_key(entry: &[u8], prefix: &[u8]) -> bool {
+    entry.starts_with(prefix) && entry[prefix.len()..].iter().fold(true, |valid, &c| valid & is_base58_char(c))
+}
+
+// Digits other than '1' and letters other than 'b', 'i' and 'o', in either case
+fn is_bech32_char(c: u8) -> bool {
+    let lower = c | 0x20;
+    (c.is_ascii_digit() & (c != b'1')) | (lower.is_ascii_lowercase() & (lower != b'b') & (lower != b'i') & (lower != b'o'))
+}
+
+// Digits other than '0' and letters other than 'I', 'O' and 'l'
+fn is_base58_char(c: u8) -> bool {
+    (c.is_ascii_digit() & (c != b'0')) | (c.is_ascii_uppercase() & (c != b'I') & (c != b'O')) | (c.is_ascii_lowercase() & (c != b'l'))
+}
+
+const fn polymod_step(checksum: u32, value: u8) -> u32 {
+    const GENERATOR: [u32; 5] = [0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3];
+    let top = checksum >> 25;
+    let mut checksum = ((checksum & 0x1ffffff) << 5) ^ value as u32;
+    let mut i = 0;
+    while i < GENERATOR.len() {
+        if (top >> i) & 1 == 1 {
+            checksum ^= GENERATOR[i];
+        }
+        i += 1;
+    }
+    checksum
+}
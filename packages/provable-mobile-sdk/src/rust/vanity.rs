@@ -0,0 +1,92 @@
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use std::sync::{Mutex, OnceLock};
+use std::time::Instant;
+
+use snarkvm_console::{account::PrivateKey, network::Network};
+
+use crate::signing::SigningContext;
+
+const BECH32_CHARSET: &str = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+const ADDRESS_PREFIX: &str = "aleo1";
+// 32 address bytes take 52 characters, followed by a 6 character checksum
+const ADDRESS_DATA_LENGTH: usize = 58;
+
+/// Brute-force search for an address whose bech32 data starts with `prefix`
+/// and ends with `suffix`.
+///
+/// `run` spins up its own threads rather than borrowing rayon's pool, so a
+/// long search never starves batch operations, and stops them as soon as one
+/// thread finds a match or `cancel` is called.
+pub struct VanitySearch<N: Network> {
+    prefix: String,
+    suffix: String,
+    attempts: AtomicU64,
+    stopped: AtomicBool,
+    started: OnceLock<Instant>,
+    found: Mutex<Option<PrivateKey<N>>>,
+}
+
+impl<N: Network> VanitySearch<N> {
+    pub fn new(prefix: &str, suffix: &str) -> Result<Self, String> {
+        let prefix = prefix.to_lowercase();
+        let suffix = suffix.to_lowercase();
+        if let Some(invalid) = prefix.chars().chain(suffix.chars()).find(|c| !BECH32_CHARSET.contains(*c)) {
+            return Err(format!("'{}' can never appear in an address", invalid));
+        }
+        if prefix.len() + suffix.len() > ADDRESS_DATA_LENGTH {
+            return Err("The pattern is longer than an address".to_string());
+        }
+        Ok(Self {
+            prefix,
+            suffix,
+            attempts: AtomicU64::new(0),
+            stopped: AtomicBool::new(false),
+            started: OnceLock::new(),
+            found: Mutex::new(None),
+        })
+    }
+
+    /// Searches on `threads` threads until a match is found or the search is
+    /// cancelled, returning `None` in the latter case.
+    pub fn run(&self, context: &SigningContext<N>, threads: usize) -> Option<PrivateKey<N>> {
+        self.started.get_or_init(Instant::now);
+        std::thread::scope(|scope| {
+            for _ in 0..threads.max(1) {
+                scope.spawn(|| self.search(context));
+            }
+        });
+        self.found.lock().unwrap().take()
+    }
+
+    pub fn cancel(&self) {
+        self.stopped.store(true, Ordering::Relaxed);
+    }
+
+    pub fn attempts(&self) -> u64 {
+        self.attempts.load(Ordering::Relaxed)
+    }
+
+    pub fn elapsed_seconds(&self) -> f64 {
+        self.started.get().map_or(0.0, |started| started.elapsed().as_secs_f64())
+    }
+
+    fn search(&self, context: &SigningContext<N>) {
+        let rng = &mut rand::thread_rng();
+        while !self.stopped.load(Ordering::Relaxed) {
+            let Ok(private_key) = PrivateKey::<N>::new(rng) else {
+                continue;
+            };
+            let Ok(address) = context.address(&private_key) else {
+                continue;
+            };
+            self.attempts.fetch_add(1, Ordering::Relaxed);
+
+            let address = address.to_string();
+            let data = &address[ADDRESS_PREFIX.len()..];
+            if data.starts_with(&self.prefix) && data.ends_with(&self.suffix) {
+                self.found.lock().unwrap().get_or_insert(private_key);
+                self.stopped.store(true, Ordering::Relaxed);
+            }
+        }
+    }
+}
@@ -2,12 +2,28 @@ export type { HybridObject } from "react-native-nitro-modules";
 export type {
   Account,
   Address,
+  AddressValidation,
+  CancellationToken,
+  DerivationCacheStats,
+  EncodedMessage,
+  NoncePoolStats,
+  OperationStats,
   PrivateKey,
+  PrivateKeyValidation,
+  RegistryStats,
+  RestoredAccount,
+  RestoredAccounts,
+  SdkStats,
+  StreamingSigner,
+  StreamingVerifier,
+  VanitySearch,
   ViewKey,
+  ViewKeyValidation,
+  WarmUpStats,
 } from "./specs/account.nitro";
 
 import { NitroModules } from "react-native-nitro-modules";
-import type { Account, Address, PrivateKey, ViewKey } from "./specs/account.nitro";
+import type { Account, Address, CancellationToken, PrivateKey, ViewKey } from "./specs/account.nitro";
 
 export const createAccount = (): Account => {
   return NitroModules.createHybridObject<Account>("Account");
@@ -32,3 +48,91 @@ export const viewKeyFromString = (viewKeyString: string): ViewKey => {
   const account = createAccount();
   return account.viewKeyFromString(viewKeyString);
 };
+
+// Split a packed batch result (u32 count | u32 offsets[count + 1] | entries) into its entries
+export const unpackBatch = (packed: ArrayBuffer): ArrayBuffer[] => {
+  const view = new DataView(packed);
+  const count = view.getUint32(0, true);
+  const entries: ArrayBuffer[] = [];
+  for (let i = 0; i < count; i++) {
+    const start = view.getUint32(4 + i * 4, true);
+    const end = view.getUint32(8 + i * 4, true);
+    entries.push(packed.slice(start, end));
+  }
+  return entries;
+};
+
+// Pack entries into the batch layout consumed by `verifyBatch`
+export const packBatch = (entries: ArrayBuffer[]): ArrayBuffer => {
+  const headerLength = 4 * (entries.length + 2);
+  const bodyLength = entries.reduce((total, entry) => total + entry.byteLength, 0);
+  const packed = new ArrayBuffer(headerLength + bodyLength);
+  const view = new DataView(packed);
+  const bytes = new Uint8Array(packed);
+  view.setUint32(0, entries.length, true);
+  let offset = headerLength;
+  view.setUint32(4, offset, true);
+  entries.forEach((entry, i) => {
+    bytes.set(new Uint8Array(entry), offset);
+    offset += entry.byteLength;
+    view.setUint32(8 + i * 4, offset, true);
+  });
+  return packed;
+};
+
+// Pack strings as UTF-8 into the batch layout consumed by `validateAddresses` and friends
+export const packStrings = (strings: string[]): ArrayBuffer => {
+  const encoder = new TextEncoder();
+  return packBatch(strings.map((string) => encoder.encode(string).buffer as ArrayBuffer));
+};
+
+export interface DerivedAccount {
+  privateKey: string;
+  viewKey: string;
+  address: string;
+}
+
+// Decode the packed result of `deriveAccounts` into one object per account
+export const unpackAccounts = (packed: ArrayBuffer): DerivedAccount[] => {
+  const decoder = new TextDecoder();
+  const entries = unpackBatch(packed).map((entry) => decoder.decode(entry));
+  const accounts: DerivedAccount[] = [];
+  for (let i = 0; i + 2 < entries.length; i += 3) {
+    accounts.push({ privateKey: entries[i]!, viewKey: entries[i + 1]!, address: entries[i + 2]! });
+  }
+  return accounts;
+};
+
+// Read bit `index` (LSB first) of a result bitmap returned by a batch method
+export const isBitSet = (bitmap: ArrayBuffer, index: number): boolean => {
+  const byte = new Uint8Array(bitmap)[index >> 3] ?? 0;
+  return (byte & (1 << (index & 7))) !== 0;
+};
+
+export interface OwnedRecord {
+  index: number;
+  plaintext: string;
+}
+
+// Decode the packed result of `scanRecords`, offsetting each index by `firstIndex`
+export const unpackOwnedRecords = (packed: ArrayBuffer, firstIndex = 0): OwnedRecord[] => {
+  const decoder = new TextDecoder();
+  return unpackBatch(packed).map((entry) => ({
+    index: firstIndex + new DataView(entry).getUint32(0, true),
+    plaintext: decoder.decode(entry.slice(4)),
+  }));
+};
+
+// Scan record ciphertexts that arrive in chunks (e.g. pages of blocks), holding one chunk in memory at a time.
+// Indices count from the first record of the first chunk
+export async function* scanRecordChunks(
+  viewKey: ViewKey,
+  chunks: Iterable<string[]> | AsyncIterable<string[]>,
+  token?: CancellationToken,
+): AsyncGenerator<OwnedRecord> {
+  let firstIndex = 0;
+  for await (const chunk of chunks) {
+    yield* unpackOwnedRecords(await viewKey.scanRecords(packStrings(chunk), token), firstIndex);
+    firstIndex += chunk.length;
+  }
+}
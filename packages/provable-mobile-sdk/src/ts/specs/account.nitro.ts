@@ -1,34 +1,204 @@
 import type { HybridObject } from "react-native-nitro-modules";
 
-// Value objects - plain interfaces for efficient struct conversion
-export interface PrivateKey {
-  // Get a string representation of the private key
-  toString(): string;
-
+// Native account objects - each one owns a parsed Rust object for its whole lifetime.
+// `toString()` is inherited from HybridObject and returns the bech32 representation synchronously.
+// Every object is thread-safe and may be used from several JS runtimes at once - pass it to a worklet runtime with
+// `NitroModules.box()`. Async work from all runtimes shares one native thread pool.
+export interface PrivateKey extends HybridObject<{ ios: "c++"; android: "c++" }> {
   // Get the address corresponding to the private key
-  toAddress(): Address;
+  toAddress(): Promise<Address>;
 
   // Get the view key corresponding to the private key
-  toViewKey(): ViewKey;
+  toViewKey(): Promise<ViewKey>;
 
   // Sign a message with the private key
-  sign(message: ArrayBuffer): ArrayBuffer;
-}
+  sign(message: ArrayBuffer, token?: CancellationToken): Promise<ArrayBuffer>;
 
-export interface Address {
-  // Get a string representation of the address
-  toString(): string;
+  // Sign a message that is already field elements, packed as 32-byte little-endian values, skipping the byte to bit
+  // expansion of `sign`. The signature verifies with `verifyFields` over the same fields. Messages starting with the
+  // largest field element are reserved for `StreamingSigner` signatures and rejected
+  signFields(fields: ArrayBuffer, token?: CancellationToken): Promise<ArrayBuffer>;
 
-  // Verify a signature against this address
-  verify(signature: ArrayBuffer, message: ArrayBuffer): boolean;
+  // Sign a message encoded once with `Account.encodeMessage`, the signature verifies with `verify` on the original bytes
+  signEncoded(message: EncodedMessage, token?: CancellationToken): Promise<ArrayBuffer>;
+
+  // Sign many messages in parallel, returning all signatures packed with an offsets table
+  // (u32 count | u32 offsets[count + 1] | signatures, little-endian) - see `unpackBatch`
+  signBatch(messages: ArrayBuffer[], token?: CancellationToken): Promise<ArrayBuffer>;
+
+  // Sign a payload that is too large to hold in memory, chunk by chunk - see `StreamingSigner`
+  createSigner(): StreamingSigner;
+
+  // The key's 32-byte little-endian seed - it is as secret as the string form
+  toBytes(): ArrayBuffer;
 }
 
-export interface ViewKey {
-  // Get a string representation of the view key
-  toString(): string;
+export interface Address extends HybridObject<{ ios: "c++"; android: "c++" }> {
+  // Verify a signature against this address
+  verify(signature: ArrayBuffer, message: ArrayBuffer, token?: CancellationToken): Promise<boolean>;
+
+  // Verify a signature over packed field elements - see `PrivateKey.signFields`
+  verifyFields(signature: ArrayBuffer, fields: ArrayBuffer, token?: CancellationToken): Promise<boolean>;
+
+  // Verify a signature over a message encoded once with `Account.encodeMessage`, without encoding it again
+  verifyEncoded(signature: ArrayBuffer, message: EncodedMessage, token?: CancellationToken): Promise<boolean>;
+
+  // Verify a `StreamingSigner` signature chunk by chunk
+  createVerifier(): StreamingVerifier;
 
+  // The address point's 32-byte little-endian x-coordinate
+  toBytes(): ArrayBuffer;
+}
+
+export interface ViewKey extends HybridObject<{ ios: "c++"; android: "c++" }> {
   // Get the address corresponding to the view key
-  toAddress(): Address;
+  toAddress(): Promise<Address>;
+
+  // The view key's 32-byte little-endian scalar
+  toBytes(): ArrayBuffer;
+
+  // Find the records this key owns among record ciphertext strings packed like `validateAddresses` input, checking
+  // them in parallel and decrypting only the owned ones. Each entry of the packed result is one owned record: its
+  // u32 little-endian index in the batch followed by the decrypted record string - see `scanRecordChunks`
+  scanRecords(records: ArrayBuffer, token?: CancellationToken): Promise<ArrayBuffer>;
+}
+
+// Streaming signatures cover an incremental Poseidon hash of the payload, so peak memory stays at one chunk.
+// They only verify with `StreamingVerifier`, not with `Address.verify` on the whole payload.
+// Await each `update` before calling `update` or `finalize` again. Updates run on the bounded background lane and
+// reject like other background work when it is full, the stream stays usable and the chunk can be passed again.
+export interface StreamingSigner extends HybridObject<{ ios: "c++"; android: "c++" }> {
+  update(chunk: ArrayBuffer): Promise<void>;
+
+  // Sign everything passed to `update` so far, the signer cannot be used afterwards
+  finalize(): Promise<ArrayBuffer>;
+}
+
+export interface StreamingVerifier extends HybridObject<{ ios: "c++"; android: "c++" }> {
+  update(chunk: ArrayBuffer): Promise<void>;
+
+  // Check the signature against everything passed to `update` so far, the verifier cannot be used afterwards
+  finalize(signature: ArrayBuffer): Promise<boolean>;
+}
+
+// A message packed into field elements once, the way `sign` and `verify` pack its bytes on every call, so it can be
+// signed and verified repeatedly without repeating the conversion
+export interface EncodedMessage extends HybridObject<{ ios: "c++"; android: "c++" }> {
+  readonly fieldCount: number;
+
+  // The field elements packed as 32-byte little-endian values, the form `signFields` and `verifyFields` take
+  toFields(): ArrayBuffer;
+}
+
+// Cancels queued crypto operations - signing and derivation run on the interactive lane,
+// verification, batch signing and stream updates on the bounded background lane
+export interface CancellationToken extends HybridObject<{ ios: "c++"; android: "c++" }> {
+  readonly isCancelled: boolean;
+
+  cancel(): void;
+}
+
+// Hit and miss counters of the derivation cache, counted since the process started
+export interface DerivationCacheStats {
+  hits: number;
+  misses: number;
+  size: number;
+  capacity: number;
+}
+
+// Latencies of one kind of operation since stats were last reset. Percentiles are read from a log-scale
+// histogram and may overestimate by up to 25%
+export interface OperationStats {
+  count: number;
+  totalMicros: number;
+  meanMicros: number;
+  p50Micros: number;
+  p90Micros: number;
+  p99Micros: number;
+  maxMicros: number;
+}
+
+// A native handle registry - live handles are native objects not yet garbage collected,
+// lock wait is the time spent blocked on a contended registry shard
+export interface RegistryStats {
+  liveHandles: number;
+  lockWaitMicros: number;
+}
+
+export interface SdkStats {
+  enabled: boolean;
+  parse: OperationStats;
+  derive: OperationStats;
+  sign: OperationStats;
+  verify: OperationStats;
+  // Whole signBatch, verifyBatch and deriveAccounts calls - batch signatures are also counted under `sign`
+  batch: OperationStats;
+  // Copies of JS buffers for async operations and of results into new buffers
+  marshal: OperationStats;
+  privateKeys: RegistryStats;
+  addresses: RegistryStats;
+  viewKeys: RegistryStats;
+  streams: RegistryStats;
+  vanitySearches: RegistryStats;
+  bytesCopied: number;
+}
+
+// Time `warmUp` spent on each part of the SDK, parts that were already initialized take close to zero
+export interface WarmUpStats {
+  registriesMillis: number;
+  networkMillis: number;
+  signingContextMillis: number;
+  threadPoolMillis: number;
+  totalMillis: number;
+}
+
+// Nonce pool state - `pooledSignatures` took a precomputed nonce, `inlineSignatures` computed their own
+export interface NoncePoolStats {
+  available: number;
+  depth: number;
+  pooledSignatures: number;
+  inlineSignatures: number;
+}
+
+// Result of a bulk validation - bit i (LSB first) of `valid` is set when entry i is valid. When parsing was
+// requested, the parsed objects of the valid entries follow in entry order, otherwise the list is empty
+export interface AddressValidation {
+  valid: ArrayBuffer;
+  addresses: Address[];
+}
+
+export interface PrivateKeyValidation {
+  valid: ArrayBuffer;
+  privateKeys: PrivateKey[];
+}
+
+export interface ViewKeyValidation {
+  valid: ArrayBuffer;
+  viewKeys: ViewKey[];
+}
+
+// Accounts rebuilt by `restoreAccounts` - `cached` of them were read from the cache file, `derived` were recomputed
+export interface RestoredAccount {
+  privateKey: PrivateKey;
+  viewKey: ViewKey;
+  address: Address;
+}
+
+export interface RestoredAccounts {
+  accounts: RestoredAccount[];
+  cached: number;
+  derived: number;
+}
+
+// A vanity address search running on every core - poll `attempts` and `attemptsPerSecond` for progress
+export interface VanitySearch extends HybridObject<{ ios: "c++"; android: "c++" }> {
+  readonly attempts: number;
+  readonly attemptsPerSecond: number;
+
+  // Resolves with the first private key whose address matches, or rejects once the search is cancelled
+  result(): Promise<PrivateKey>;
+
+  cancel(): void;
 }
 
 // Account utilities - static methods for creating account objects
@@ -45,6 +215,11 @@ export interface Account extends HybridObject<{ ios: "c++"; android: "c++" }> {
   // Get a view key from a string representation
   viewKeyFromString(viewKey: string): ViewKey;
 
+  // Get account objects from their `toBytes()` form, skipping the bech32 decoding and checksum of the string form
+  privateKeyFromBytes(bytes: ArrayBuffer): PrivateKey;
+  addressFromBytes(bytes: ArrayBuffer): Address;
+  viewKeyFromBytes(bytes: ArrayBuffer): ViewKey;
+
   // Get an address from a private key
   addressFromPrivateKey(privateKey: PrivateKey): Address;
 
@@ -53,4 +228,83 @@ export interface Account extends HybridObject<{ ios: "c++"; android: "c++" }> {
 
   // Get an address from a view key
   addressFromViewKey(viewKey: ViewKey): Address;
+
+  // Encode a message for `signEncoded` and `verifyEncoded`, throws if it is too long to sign
+  encodeMessage(message: ArrayBuffer): EncodedMessage;
+
+  // Wrap field elements packed like `toFields()` output, throws if any is not below the field modulus or the first is
+  // the largest field element (reserved for `StreamingSigner` signatures)
+  encodedMessageFromFields(fields: ArrayBuffer): EncodedMessage;
+
+  // Verify packed (address, signature, message) triples in parallel - entries use the same
+  // offsets layout as `signBatch`, and bit i (LSB first) of the returned bitmap is set when triple i is valid
+  verifyBatch(triples: ArrayBuffer, token?: CancellationToken): Promise<ArrayBuffer>;
+
+  // Validate strings packed like `verifyBatch` input (see `packStrings`) in one call. Malformed entries are
+  // rejected by cheap prefix, charset and (for addresses) checksum checks before the rest are decoded in parallel.
+  // With `parse`, the decoded objects are returned as well, saving a second pass through `addressFromString`
+  validateAddresses(addresses: ArrayBuffer, parse?: boolean, token?: CancellationToken): Promise<AddressValidation>;
+  validatePrivateKeys(privateKeys: ArrayBuffer, parse?: boolean, token?: CancellationToken): Promise<PrivateKeyValidation>;
+  validateViewKeys(viewKeys: ArrayBuffer, parse?: boolean, token?: CancellationToken): Promise<ViewKeyValidation>;
+
+  // Create a token that cancels the operations it is passed to if they have not started yet
+  createCancellationToken(): CancellationToken;
+
+  // Limit how many background operations (verification, batch signing) may be queued before new ones are rejected
+  setMaxQueuedJobs(limit: number): void;
+
+  // Memoize the address and view key derived from up to `size` private keys (0, the default, disables the cache).
+  // Evicted view keys are zeroized
+  setDerivationCacheSize(size: number): void;
+
+  getDerivationCacheStats(): DerivationCacheStats;
+
+  // Keep up to `size` decoded addresses keyed by their string (default 256, 0 disables the cache),
+  // so `addressFromString` and `verifyBatch` skip decoding addresses they have seen before
+  setAddressCacheSize(size: number): void;
+
+  // Decode a known contact list into the address cache ahead of time, resolving with the number of valid addresses
+  warmAddressCache(addresses: string[]): Promise<number>;
+
+  // Keep up to `depth` signing nonces and their commitments precomputed on a background thread (0, the default,
+  // disables the pool and wipes its nonces). Each `sign` takes one, skipping a quarter of its scalar multiplications,
+  // and the pool is topped back up to `depth` once fewer than `refillBelow` (default half the depth) remain.
+  // Every nonce signs at most one message; batch signing computes its own so it can't drain the pool
+  setNoncePoolSize(depth: number, refillBelow?: number): void;
+
+  getNoncePoolStats(): NoncePoolStats;
+
+  // Build the fixed-base tables used by signing, derivation and verification ahead of time.
+  // Otherwise they are built by the first operation that needs them
+  prepareSigningContext(): Promise<void>;
+
+  // Initialize everything the first key, signature or verification would otherwise pay for: network constants,
+  // signing tables, object registries and the thread pool. This runs once per process and is started in the
+  // background when the library loads unless built with PROVABLE_MOBILE_SDK_NO_WARM_UP. Resolves with the
+  // timings of that single run
+  warmUp(): Promise<WarmUpStats>;
+
+  // Deterministically derive the accounts at indices [startIndex, startIndex + count) of a 32-byte seed in parallel,
+  // at most 4096 per call.
+  // Entries are packed like `signBatch` output as (private key, view key, address) strings - see `unpackAccounts`
+  deriveAccounts(seed: ArrayBuffer, startIndex: number, count: number): Promise<ArrayBuffer>;
+
+  // Rebuild the accounts of `privateKeys` in order, reading their view keys and addresses from the cache file at `path`
+  // instead of deriving them. The file is memory-mapped and encrypted under a 32-byte `secret` (keep it in the platform
+  // keystore). Missing, corrupt or stale entries are derived instead and the file is rewritten to match `privateKeys`,
+  // so the first call after a change pays for the derivation. Failing to write the file doesn't fail the call
+  restoreAccounts(path: string, secret: ArrayBuffer, privateKeys: string[]): Promise<RestoredAccounts>;
+
+  // Search for an address whose characters after "aleo1" start with `prefix` and end with `suffix` (either may be empty).
+  // Every extra character makes the search about 32 times longer
+  startVanitySearch(prefix: string, suffix: string): VanitySearch;
+
+  // Record operation latencies, lock wait times and copied bytes (disabled by default).
+  // Live handle counts are always available
+  setStatsEnabled(enabled: boolean): void;
+
+  getStats(): SdkStats;
+
+  // Clear latencies, lock wait times and copied bytes
+  resetStats(): void;
 }